@@ -1,4 +1,17 @@
 #pragma once
 
 #include "RTTRInvoke/RTTRInvoke.hpp"
+#include "RTTRHandle/RTTRHandle.hpp"
+#include "RTTRBatch/RTTRBatch.hpp"
+#include "RTTRDiff/RTTRDiff.hpp"
+#include "RTTRDirty/RTTRDirty.hpp"
 #include "RTTRRegister/RTTRRegister.hpp"
+#include "RTTRRegister/RTTRBuiltin.hpp"
+#include "RTTRJson/RTTRJson.hpp"
+#include "RTTRPool/RTTRPool.hpp"
+#include "RTTRProfile/RTTRProfile.hpp"
+#include "RTTRSerialize/RTTRSerialize.hpp"
+#include "RTTRSnapshot/RTTRSnapshot.hpp"
+#include "RTTRStatic/RTTRStatic.hpp"
+#include "RTTRValue/RTTRValue.hpp"
+#include "RTTRVariant/RTTRVariant.hpp"
@@ -0,0 +1,55 @@
+#include <assert.h>
+
+#include <cstddef>
+
+#include "RTTRArena.hpp"
+
+RTTR::Arena& RTTR::Arena::instance()
+{
+	//澲̬̬ʱԿܷҷȥڴڽ˳ǰʼտɴ
+	static auto s_instance{ new Arena{} };
+	return *s_instance;
+}
+
+void* RTTR::Arena::allocate(size_t size, size_t alignment)
+{
+	assert(alignment && (alignment & (alignment - 1)) == 0 && alignment <= alignof(std::max_align_t));
+
+	std::lock_guard lock{ m_mutex };
+
+	auto padding{ (alignment - reinterpret_cast<uintptr_t>(m_cursor) % alignment) % alignment };
+	if (nullptr == m_cursor || padding + size > m_remaining)
+	{
+		//һСķ䵥ռһ飬˷ѵǰʣռ
+		auto chunkSize{ std::max(size, ChunkSize) };
+		auto& chunk{ m_chunks.emplace_back(new unsigned char[chunkSize]) };
+		m_reserved += chunkSize;
+		if (size > ChunkSize / 2 && m_cursor)
+		{
+			m_used += size;
+			return chunk.get();
+		}
+
+		m_cursor = chunk.get();
+		m_remaining = chunkSize;
+		padding = 0;
+	}
+
+	auto memory{ m_cursor + padding };
+	m_cursor += padding + size;
+	m_remaining -= padding + size;
+	m_used += size;
+	return memory;
+}
+
+size_t RTTR::Arena::reserved() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_reserved;
+}
+
+size_t RTTR::Arena::used() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_used;
+}
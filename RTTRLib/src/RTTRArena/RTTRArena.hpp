@@ -0,0 +1,240 @@
+#pragma once
+
+#include <assert.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RTTR
+{
+	/// <summary>
+	/// Ԫڴ
+	/// ֻ䲻ͷţעе䣬ͬ
+	/// </summary>
+	class Arena
+	{
+	public:
+		/// <summary>
+		/// ȫڴ
+		/// </summary>
+		/// <returns></returns>
+		static Arena& instance();
+
+	public:
+		Arena() = default;
+		Arena(const Arena&) = delete;
+		Arena& operator =(const Arena&) = delete;
+
+	public:
+		/// <summary>
+		/// һڴ棬̰߳ȫ
+		/// </summary>
+		/// <param name="size">С</param>
+		/// <param name="alignment"></param>
+		/// <returns></returns>
+		void* allocate(size_t size, size_t alignment);
+
+		/// <summary>
+		/// countTδʼ洢
+		/// </summary>
+		/// <typeparam name="T"></typeparam>
+		/// <param name="count"></param>
+		/// <returns></returns>
+		template<typename T>
+		T* allocate(size_t count) { return static_cast<T*>(allocate(sizeof(T) * count, alignof(T))); }
+
+		/// <summary>
+		/// ϵͳֽ
+		/// </summary>
+		/// <returns></returns>
+		size_t reserved() const;
+
+		/// <summary>
+		/// ѷȥֽ
+		/// </summary>
+		/// <returns></returns>
+		size_t used() const;
+
+	private:
+		static constexpr size_t ChunkSize{ 64 * 1024 };
+
+	private:
+		mutable std::mutex m_mutex{};
+		std::vector<std::unique_ptr<unsigned char[]>> m_chunks{};
+		unsigned char* m_cursor{ nullptr };
+		size_t m_remaining{ 0 };
+		size_t m_reserved{ 0 };
+		size_t m_used{ 0 };
+	};
+
+	/// <summary>
+	/// ֶ
+	/// Ԫڴԭعƶÿ
+	/// Ԫƽ鱾ͷ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	class ArenaArray
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "ArenaArray never destroys its elements");
+
+	private:
+		struct Block
+		{
+		public:
+			T* data() { return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(this) + DataOffset); }
+
+		public:
+			Block* next{ nullptr };
+			uint32_t capacity{ 0 };
+			uint32_t size{ 0 };
+		};
+
+		static constexpr size_t DataOffset{ (sizeof(Block) + alignof(T) - 1) / alignof(T) * alignof(T) };
+		static constexpr uint32_t FirstCapacity{ sizeof(T) > 64 ? 2 : 4 };		//׶ȡСһЩֻעһʱ˷
+
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const T*;
+			using reference = const T&;
+
+		public:
+			Iterator() = default;
+			explicit Iterator(Block* block) : m_block(block) {}
+
+		public:
+			reference operator *() const { return m_block->data()[m_index]; }
+			pointer operator ->() const { return &m_block->data()[m_index]; }
+
+			Iterator& operator ++()
+			{
+				if (++m_index == m_block->size)
+				{
+					m_block = m_block->next;
+					m_index = 0;
+				}
+				return *this;
+			}
+
+			Iterator operator ++(int) { auto old{ *this }; ++*this; return old; }
+
+			bool operator ==(const Iterator& other) const { return m_block == other.m_block && m_index == other.m_index; }
+
+		private:
+			Block* m_block{ nullptr };
+			uint32_t m_index{ 0 };
+		};
+
+	public:
+		ArenaArray() = default;
+		ArenaArray(const ArenaArray&) = delete;
+		ArenaArray& operator =(const ArenaArray&) = delete;
+
+	public:
+		/// <summary>
+		/// ĩβԭعһԪ
+		/// </summary>
+		/// <returns>Ԫصĵַ˺󲻻ı</returns>
+		template<typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (nullptr == m_last || m_last->size == m_last->capacity)
+			{
+				uint32_t capacity{ m_last ? m_last->capacity * 2 : FirstCapacity };
+				auto memory{ Arena::instance().allocate(DataOffset + sizeof(T) * capacity, std::max(alignof(Block), alignof(T))) };
+				auto block{ new (memory) Block{ nullptr, capacity, 0 } };
+				(m_last ? m_last->next : m_first) = block;
+				m_last = block;
+			}
+
+			auto element{ new (m_last->data() + m_last->size) T(std::forward<Args>(args)...) };
+			++m_last->size;
+			++m_size;
+			return *element;
+		}
+
+		Iterator begin() const { return Iterator{ m_first }; }
+		Iterator end() const { return Iterator{}; }
+
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+
+	private:
+		Block* m_first{ nullptr };
+		Block* m_last{ nullptr };
+		size_t m_size{ 0 };
+	};
+
+	/// <summary>
+	/// 
+	/// ſƽƵԪأʱڴ·䲢ƣɴ洢
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	class ArenaVector
+	{
+		static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "ArenaVector relocates with memcpy");
+
+	public:
+		ArenaVector() = default;
+		ArenaVector(const ArenaVector&) = delete;
+		ArenaVector& operator =(const ArenaVector&) = delete;
+
+	public:
+		void push_back(const T& value)
+		{
+			if (m_size == m_capacity)
+			{
+				uint32_t capacity{ m_capacity ? m_capacity * 2 : 4 };
+				auto data{ Arena::instance().allocate<T>(capacity) };
+				if (m_size) std::memcpy(static_cast<void*>(data), m_data, sizeof(T) * m_size);
+				m_data = data;
+				m_capacity = capacity;
+			}
+			new (m_data + m_size++) T(value);
+		}
+
+		/// <summary>
+		/// pos룬Ԫغ
+		/// </summary>
+		/// <param name="pos"></param>
+		/// <param name="value"></param>
+		void insert(size_t pos, const T& value)
+		{
+			assert(pos <= m_size);
+
+			push_back(value);
+			std::memmove(static_cast<void*>(m_data + pos + 1), m_data + pos, sizeof(T) * (m_size - 1 - pos));
+			m_data[pos] = value;
+		}
+
+		const T& operator [](size_t pos) const { return m_data[pos]; }
+
+		std::span<const T> span() const { return { m_data, m_size }; }
+
+		const T* begin() const { return m_data; }
+		const T* end() const { return m_data + m_size; }
+
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+
+	private:
+		T* m_data{ nullptr };
+		uint32_t m_size{ 0 };
+		uint32_t m_capacity{ 0 };
+	};
+}
@@ -0,0 +1,216 @@
+#include <assert.h>
+
+#include <algorithm>
+#include <exception>
+
+#include "RTTRBatch.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ǰ̳߳߳
+	/// </summary>
+	static thread_local const ThreadPool* t_pool{ nullptr };
+	static thread_local size_t t_index{ 0 };
+
+	/// <summary>
+	/// ԶѡСʱÿ߳ƽֵּԱɵ߳ȡ
+	/// </summary>
+	static constexpr size_t s_rangesPerThread{ 8 };
+
+	/// <summary>
+	/// parallelForĹ״̬ɵ߳Эͬ
+	/// Эڵ÷غſʼִУʱȡ꣬ٷbody
+	/// </summary>
+	struct ParallelRange
+	{
+	public:
+		/// <summary>
+		/// ȡһִУֱȡ
+		/// </summary>
+		void run()
+		{
+			for (auto range{ next.fetch_add(1, std::memory_order_relaxed) }; range < ranges; range = next.fetch_add(1, std::memory_order_relaxed))
+			{
+				if (!failed.load(std::memory_order_relaxed))
+				{
+					try
+					{
+						(*body)(range * grain, std::min(count, (range + 1) * grain));
+					}
+					catch (...)
+					{
+						if (!failed.exchange(true)) error = std::current_exception();
+					}
+				}
+				done.fetch_add(1, std::memory_order_release);
+			}
+		}
+
+	public:
+		const std::function<void(size_t, size_t)>* body{ nullptr };
+		size_t count{ 0 };
+		size_t grain{ 0 };
+		size_t ranges{ 0 };
+		std::atomic<size_t> next{ 0 };
+		std::atomic<size_t> done{ 0 };
+		std::atomic<bool> failed{ false };
+		std::exception_ptr error{};		//ֻɵһʧܵ߳д룬doneﵽrangesȡ
+	};
+}
+
+RTTR::ThreadPool::ThreadPool(size_t threads)
+{
+	if (0 == threads) threads = std::max(1u, std::thread::hardware_concurrency());
+
+	m_workers.reserve(threads);
+	for (size_t i = 0; i < threads; ++i) m_workers.push_back(std::make_unique<Worker>());
+	for (size_t i = 0; i < threads; ++i) m_workers[i]->thread = std::thread{ &ThreadPool::work, this, i };
+}
+
+RTTR::ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard lock{ m_mutex };
+		m_stop = true;
+	}
+	m_wake.notify_all();
+
+	for (auto& worker : m_workers) worker->thread.join();
+}
+
+RTTR::ThreadPool& RTTR::ThreadPool::instance()
+{
+	static ThreadPool pool{};
+	return pool;
+}
+
+void RTTR::ThreadPool::submit(Task task)
+{
+	assert(task);
+
+	auto index{ current() };
+	if (index == size()) index = m_next.fetch_add(1, std::memory_order_relaxed) % size();
+
+	//ȼӣСڶе
+	{
+		std::lock_guard lock{ m_mutex };
+		m_queued.fetch_add(1, std::memory_order_relaxed);
+	}
+	{
+		auto& worker{ *m_workers[index] };
+		std::lock_guard lock{ worker.mutex };
+		worker.tasks.push_back(std::move(task));
+	}
+	m_wake.notify_one();
+}
+
+void RTTR::ThreadPool::parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body)
+{
+	if (0 == count) return;
+	if (0 == grain) grain = std::max<size_t>(1, count / ((size() + 1) * s_rangesPerThread));
+
+	auto ranges{ (count + grain - 1) / grain };
+	if (1 == ranges)
+	{
+		body(0, count);
+		return;
+	}
+
+	auto state{ std::make_shared<ParallelRange>() };
+	state->body = &body;
+	state->count = count;
+	state->grain = grain;
+	state->ranges = ranges;
+
+	//ÿ߳һЭ֮䶯̬
+	auto helpers{ std::min(size(), ranges - 1) };
+	for (size_t i = 0; i < helpers; ++i) submit([state] { state->run(); });
+
+	state->run();
+	while (state->done.load(std::memory_order_acquire) < ranges)
+		if (!runOne()) std::this_thread::yield();
+
+	if (state->error) std::rethrow_exception(state->error);
+}
+
+bool RTTR::ThreadPool::runOne()
+{
+	Task task{};
+	if (!pop(current(), task)) return false;
+
+	task();
+	return true;
+}
+
+bool RTTR::ThreadPool::pop(size_t index, Task& task)
+{
+	if (0 == m_queued.load(std::memory_order_relaxed)) return false;
+
+	auto take{ [this, &task](Worker& worker, bool back)
+		{
+			std::lock_guard lock{ worker.mutex };
+			if (worker.tasks.empty()) return false;
+
+			if (back)
+			{
+				task = std::move(worker.tasks.back());
+				worker.tasks.pop_back();
+			}
+			else
+			{
+				task = std::move(worker.tasks.front());
+				worker.tasks.pop_front();
+			}
+			m_queued.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		} };
+
+	if (index < size() && take(*m_workers[index], true)) return true;
+
+	for (size_t i = 1; i <= size(); ++i)
+	{
+		auto victim{ (index + i) % size() };
+		if (victim != index && take(*m_workers[victim], false)) return true;
+	}
+	return false;
+}
+
+void RTTR::ThreadPool::work(size_t index)
+{
+	t_pool = this;
+	t_index = index;
+
+	Task task{};
+	while (true)
+	{
+		if (pop(index, task))
+		{
+			task();
+			task = nullptr;
+			continue;
+		}
+
+		std::unique_lock lock{ m_mutex };
+		m_wake.wait(lock, [this] { return m_stop || m_queued.load(std::memory_order_relaxed) > 0; });
+		if (m_stop && 0 == m_queued.load(std::memory_order_relaxed)) return;
+	}
+}
+
+size_t RTTR::ThreadPool::current() const
+{
+	return t_pool == this ? t_index : size();
+}
+
+void RTTR::callBatch(const MethodInfo& method, std::span<void* const> objects, void** args, void* results, ThreadPool* pool)
+{
+	auto stride{ results ? method.returnInfo->size() : 0 };
+	auto range{ [&method, objects, args, results, stride](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+				method.call(objects[i], args, stride ? static_cast<unsigned char*>(results) + i * stride : nullptr);
+		} };
+
+	if (nullptr == pool) range(0, objects.size());
+	else pool->parallelFor(objects.size(), 0, range);
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "RTTRInvoke/RTTRInvoke.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ȡ̳߳
+	/// ÿ߳ԼУӶβȡԼԼĶΪʱ̵߳Ķȡ
+	/// ߳ύ뱾̵߳ĶУ߳ύָ߳
+	/// </summary>
+	class ThreadPool
+	{
+	public:
+		/// <summary>
+		/// 񣬲Ӧ׳쳣Ҫ쳣ʱʹasync
+		/// </summary>
+		using Task = std::function<void()>;
+
+	public:
+		/// <summary>
+		/// </summary>
+		/// <param name="threads">߳0ʾstd::thread::hardware_concurrency()</param>
+		explicit ThreadPool(size_t threads = 0);
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator =(const ThreadPool&) = delete;
+
+		/// <summary>
+		/// ִύ߳
+		/// </summary>
+		~ThreadPool();
+
+	public:
+		/// <summary>
+		/// õ̳߳أ״ʹʱ߳Ϊhardware_concurrency()
+		/// </summary>
+		/// <returns></returns>
+		static ThreadPool& instance();
+
+		/// <summary>
+		/// ߳
+		/// </summary>
+		/// <returns></returns>
+		size_t size() const { return m_workers.size(); }
+
+		/// <summary>
+		/// ύ
+		/// </summary>
+		/// <param name="task"></param>
+		void submit(Task task);
+
+		/// <summary>
+		/// ύfutureȡ÷ֵ쳣
+		/// </summary>
+		/// <param name="func">func()</param>
+		/// <returns></returns>
+		template<typename Func>
+		auto async(Func func) -> std::future<std::invoke_result_t<Func&>>
+		{
+			auto task{ std::make_shared<std::packaged_task<std::invoke_result_t<Func&>()>>(std::move(func)) };
+			auto future{ task->get_future() };
+			submit([task] { (*task)(); });
+			return future;
+		}
+
+		/// <summary>
+		/// [0, count)Ϊÿgrain䣬body(begin, end)ִУȫɺ󷵻
+		/// ߳ҲִУȴʱЭִже˿ڹ߳Ƕ׵
+		/// body׳쳣ʱٿʼµ䣬ȫ׳һ쳣
+		/// </summary>
+		/// <param name="count">Ԫظ</param>
+		/// <param name="grain">ÿεԪظ0ʾ߳Զѡ</param>
+		/// <param name="body"></param>
+		void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+		/// <summary>
+		/// ڵִ߳һŶӵ
+		/// </summary>
+		/// <returns>ûŶӵʱfalse</returns>
+		bool runOne();
+
+	private:
+		struct Worker
+		{
+		public:
+			std::mutex mutex{};
+			std::deque<Task> tasks{};
+			std::thread thread{};
+		};
+
+	private:
+		/// <summary>
+		/// ȡһȡindex߳ԼĶβٴ̵߳Ķȡ
+		/// </summary>
+		/// <param name="index">߳ţǱ̳߳صĹ߳ʱΪsize()</param>
+		/// <param name="task"></param>
+		/// <returns></returns>
+		bool pop(size_t index, Task& task);
+
+		/// <summary>
+		/// ̵߳ѭ
+		/// </summary>
+		void work(size_t index);
+
+		/// <summary>
+		/// ǰ߳ڱ̳߳еţǹ߳ʱΪsize()
+		/// </summary>
+		size_t current() const;
+
+	private:
+		std::vector<std::unique_ptr<Worker>> m_workers{};
+		std::mutex m_mutex{};
+		std::condition_variable m_wake{};
+		std::atomic<size_t> m_queued{ 0 };	//Ŷӵʱm_mutex⹤̴߳
+		std::atomic<size_t> m_next{ 0 };		//ⲿ߳ύʱѡĶ
+		bool m_stop{ false };
+	};
+
+	/// <summary>
+	/// ʱÿķֵͣõķΪָ
+	/// </summary>
+	template<typename F, typename... Args>
+	using batch_result_t = std::conditional_t<std::is_reference_v<std::invoke_result_t<F, typename member_method_traits<F>::class_t*, Args...>>,
+		std::remove_reference_t<std::invoke_result_t<F, typename member_method_traits<F>::class_t*, Args...>>*,
+		std::invoke_result_t<F, typename member_method_traits<F>::class_t*, Args...>>;
+
+	/// <summary>
+	/// ͬobjects[begin, end)ϵ÷
+	/// </summary>
+	template<typename F, typename... Args>
+	static void invokeRange(const MethodInfo& method, std::span<void* const> objects, batch_result_t<F, Args...>* results, size_t begin, size_t end, const Args&... args)
+	{
+		using class_t = typename member_method_traits<F>::class_t;
+		using result_t = std::invoke_result_t<F, class_t*, Args...>;
+
+		for (size_t i = begin; i < end; ++i)
+		{
+			auto o{ static_cast<class_t*>(objects[i]) };
+			if constexpr (std::is_void_v<result_t>) method.template invoke<F>(o, args...);
+			else if constexpr (std::is_reference_v<result_t>)
+			{
+				auto& result{ method.template invoke<F>(o, args...) };
+				if (results) results[i] = &result;
+			}
+			else if (results) results[i] = method.template invoke<F>(o, args...);
+			else method.template invoke<F>(o, args...);
+		}
+	}
+
+	/// <summary>
+	/// ͬÿϵͬһͨconst
+	/// ֻһΣRTTRInfo::normalMethod(name, signature)ȡ
+	/// </summary>
+	/// <typeparam name="F">Ա</typeparam>
+	/// <param name="method">Ϣ</param>
+	/// <param name="objects"></param>
+	/// <param name="results">ֵobjects.size()iӦobjects[i]voidҪֵʱnullptr</param>
+	/// <param name="pool">Ϊnullptrʱڵ߳εãֵ̳߳زе</param>
+	/// <param name="...args">ÿεøһ</param>
+	template<typename F, typename... Args>
+	static void invokeBatch(const MethodInfo& method, std::span<void* const> objects, batch_result_t<F, Args...>* results, ThreadPool* pool, const Args&... args)
+	{
+		if (nullptr == pool)
+		{
+			invokeRange<F, Args...>(method, objects, results, 0, objects.size(), args...);
+			return;
+		}
+
+		pool->parallelFor(objects.size(), 0, [&](size_t begin, size_t end)
+			{
+				invokeRange<F, Args...>(method, objects, results, begin, end, args...);
+			});
+	}
+
+	/// <summary>
+	/// ̳߳첽ִinvokeBatch
+	/// methodobjectsresults豣Чֱfutureɣֵ
+	/// </summary>
+	/// <returns>ȫɺ׳ĵһ쳣future</returns>
+	template<typename F, typename... Args>
+	static std::future<void> invokeBatchAsync(const MethodInfo& method, std::span<void* const> objects, batch_result_t<F, Args...>* results, ThreadPool& pool, const Args&... args)
+	{
+		return pool.async([&method, objects, results, &pool, ...args = args]
+			{
+				invokeBatch<F, Args...>(method, objects, results, &pool, args...);
+			});
+	}
+
+	/// <summary>
+	/// ͨͲĵã÷֪ͣڰõĵ
+	/// </summary>
+	/// <param name="method">Ϣ</param>
+	/// <param name="objects"></param>
+	/// <param name="args">ָ飬еù</param>
+	/// <param name="results">δʼķֵ洢returnInfo->size()objects.size()úɵ÷Ϊnullptr</param>
+	/// <param name="pool">Ϊnullptrʱڵ߳ε</param>
+	void callBatch(const MethodInfo& method, std::span<void* const> objects, void** args, void* results, ThreadPool* pool);
+}
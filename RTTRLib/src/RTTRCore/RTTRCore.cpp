@@ -2,25 +2,31 @@
 
 #include "RTTRCore.hpp"
 
-RTTR::Superclass::Superclass(Interview interview, RTTRInfo* info) :
-	interview(interview), info(info)
+RTTR::Superclass::Superclass(Interview interview, RTTRInfo* info, std::ptrdiff_t offset) :
+	interview(interview), info(info), offset(interview & Virtual ? UnknownOffset : offset)
 {
 	assert(interview && info);
 }
 
-RTTR::MemberInfo::MemberInfo(const std::string& name, Interview interview, RTTRInfo* info) :
+RTTR::MemberInfo::MemberInfo(std::string_view name, Interview interview, RTTRInfo* info) :
 	name(name), interview(interview), info(info)
 {
 	assert(!name.empty() && interview && info);
 }
 
-RTTR::StaticMemberInfo::StaticMemberInfo(const std::string& name, Interview interview, RTTRInfo* info, const void* address) : MemberInfo(name, interview, info),
+RTTR::StaticMemberInfo::StaticMemberInfo(std::string_view name, Interview interview, RTTRInfo* info, const void* address) : MemberInfo(name, interview, info),
 	address(address)
 {
 	assert(address);
 }
 
-RTTR::NormalMemberInfo::NormalMemberInfo(const std::string& name, Interview interview, RTTRInfo* info, int offset) : MemberInfo(name, interview, info),
-	offset(offset)
+RTTR::NormalMemberInfo::NormalMemberInfo(std::string_view name, Interview interview, RTTRInfo* info, int offset, int dirtyOffset, uint32_t ordinal) : MemberInfo(name, interview, info),
+	offset(offset), dirtyOffset(dirtyOffset), ordinal(ordinal)
 {
 }
+
+RTTR::ConstructorInfo::ConstructorInfo(Interview interview, Invoker invoker, void (*callable)(), const std::type_info* callableType, std::span<RTTRInfo* const> args, Signature signature) :
+	interview(interview), invoker(invoker), callable(callable), callableType(callableType), args(args), signature(signature)
+{
+	assert(interview && invoker && callable && callableType);
+}
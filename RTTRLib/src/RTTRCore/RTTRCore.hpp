@@ -1,13 +1,68 @@
 #pragma once
 
-#include <any>
-#include <list>
+#include <assert.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "RTTRProfile/RTTRProfile.hpp"
 
 namespace RTTR
 {
 	class RTTRInfo;
+	class Variant;
+
+	/// <summary>
+	/// IDעʱڱڼ(FNV-1a)
+	/// </summary>
+	using TypeId = std::uint64_t;
+
+	/// <summary>
+	/// ӦID
+	/// </summary>
+	/// <param name="name"></param>
+	/// <returns></returns>
+	constexpr TypeId typeId(std::string_view name)
+	{
+		TypeId hash{ 14695981039346656037ull };
+		for (auto c : name) hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+		return hash;
+	}
+
+	/// <summary>
+	/// ǩָƣɷֵIDڱϵõ
+	/// </summary>
+	using Signature = std::uint64_t;
+
+	/// <summary>
+	/// ϢMǷinfoһ£RTTRInfo.h
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="info">עʱ¼Ϣ</param>
+	/// <returns></returns>
+	template<typename M>
+	bool isType(const RTTRInfo* info);
+
+	/// <summary>
+	/// 㺯FǩָƣRTTRInfo.h
+	/// </summary>
+	/// <typeparam name="F"></typeparam>
+	template<typename F>
+	struct signature_traits;
 
 	enum Interview : unsigned char
 	{
@@ -24,23 +79,169 @@ namespace RTTR
 	struct Superclass
 	{
 	public:
-		Superclass(Interview interview, RTTRInfo* info);
+		/// <summary>
+		/// ָδ֪̳Сɷʻĸֻ࣬жϼ̳йϵתָ
+		/// </summary>
+		static constexpr std::ptrdiff_t UnknownOffset{ PTRDIFF_MIN };
+
+	public:
+		Superclass(Interview interview, RTTRInfo* info, std::ptrdiff_t offset = UnknownOffset);
 
 	public:
 		const Interview interview;
 		RTTRInfo* const info;
+		const std::ptrdiff_t offset;		//ָתΪָʱϵֽ
+	};
+
+	/// <summary>
+	/// ջϵĴ洢йһTַfuncڼ㸸ֻѹĶϽеָ
+	/// ƽĬϹҿƽֻʼڣִκδ룻ĬϹһʱ󣬵ú
+	/// </summary>
+	/// <typeparam name="T">ĬϹ</typeparam>
+	/// <param name="func">func(T*, unsigned char* storage)</param>
+	/// <returns>funcķֵ</returns>
+	template<typename T, typename F>
+	static auto withObject(F&& func)
+	{
+		static_assert(std::is_default_constructible_v<T>, "This offset can only be measured on a default constructed object");
+
+		alignas(T) unsigned char storage[sizeof(T)];
+		if constexpr (std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>) return func(::new (static_cast<void*>(storage)) T, storage);
+		else
+		{
+			auto o{ ::new (static_cast<void*>(storage)) T{} };
+			auto result{ func(o, storage) };
+			std::destroy_at(o);
+			return result;
+		}
+	}
+
+	/// <summary>
+	/// TBָ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <typeparam name="B"></typeparam>
+	/// <returns>̳Сɷʵĸ򲻿ĬϹͷSuperclass::UnknownOffset</returns>
+	template<typename T, typename B>
+	static std::ptrdiff_t superclassOffset()
+	{
+		//˫static_cast˵ǿɷʵķ鸸࣬޹
+		if constexpr (requires(T* derived, B* base) { static_cast<B*>(derived); static_cast<T*>(base); } && std::is_default_constructible_v<T>)
+		{
+			return withObject<T>([](T* derived, unsigned char* storage) -> std::ptrdiff_t { return reinterpret_cast<unsigned char*>(static_cast<B*>(derived)) - storage; });
+		}
+		else return Superclass::UnknownOffset;
+	}
+
+	/// <summary>
+	/// ȡԱָģ
+	/// </summary>
+	/// <typeparam name="P">̬ԱΪָ룬ͨԱΪԱָ</typeparam>
+	template<typename P>
+	struct member_traits {};
+
+	template<typename M>
+	struct member_traits<M*>
+	{
+		using value_t = M;
+		using class_t = void;
+	};
+
+	template<typename M, typename C>
+	struct member_traits<M C::*>
+	{
+		using value_t = M;
+		using class_t = C;
+	};
+
+	/// <summary>
+	/// ͨԱԶʼַƫƣ
+	/// ݳԱָItanium ABIptrdiff_tƫƣMSVC ABIз̳еintƫƣλתƫƣ
+	/// ʾ(MSVCд)ֻĬϹʱϲ
+	/// </summary>
+	/// <typeparam name="Pointer">&T::Name</typeparam>
+	template<auto Pointer>
+	static int memberOffset()
+	{
+		using pointer_t = decltype(Pointer);
+		using class_t = typename member_traits<pointer_t>::class_t;
+#ifdef _MSC_VER
+		using offset_t = int;
+#else
+		using offset_t = std::ptrdiff_t;
+#endif
+		if constexpr (sizeof(pointer_t) == sizeof(offset_t)) return static_cast<int>(std::bit_cast<offset_t>(Pointer));
+		else
+		{
+			static const int s_offset{ withObject<class_t>([](class_t* o, unsigned char* storage)
+				{
+					return static_cast<int>(reinterpret_cast<unsigned char*>(std::addressof(o->*Pointer)) - storage);
+				}) };
+			return s_offset;
+		}
+	}
+
+	/// <summary>
+	/// ѡ̬
+	/// Ϊգ˺겻شβ涺
+	/// </summary>
+	/// <typeparam name="...Args"></typeparam>
+	template<typename... Args>
+	struct overload
+	{
+		template<typename R>
+		static constexpr auto of(R(*callable)(Args...)) { return callable; }
+	};
+
+	/// <summary>
+	/// Ϣ
+	/// </summary>
+	struct Ancestor
+	{
+	public:
+		const RTTRInfo* info;
+		std::ptrdiff_t offset;			//ӵǰ͵ȵָSuperclass::offset
+	};
+
+	/// <summary>
+	/// ؼ̳йϵҵĳԱ򷽷
+	/// </summary>
+	/// <typeparam name="T">ԱϢָ򷽷ͼ</typeparam>
+	template<typename T>
+	struct Inherited
+	{
+	public:
+		explicit operator bool() const
+		{
+			if constexpr (requires { info.empty(); }) return !info.empty();
+			else return info != nullptr;
+		}
+
+		/// <summary>
+		/// ѶָΪóԱָ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns>δ֪ʱnullptr</returns>
+		void* adjust(void* o) const { return offset == Superclass::UnknownOffset ? nullptr : static_cast<unsigned char*>(o) + offset; }
+		const void* adjust(const void* o) const { return offset == Superclass::UnknownOffset ? nullptr : static_cast<const unsigned char*>(o) + offset; }
+
+	public:
+		T info{};
+		const RTTRInfo* owner{ nullptr };		//óԱ
+		std::ptrdiff_t offset{ 0 };
 	};
 
 	/// <summary>
 	/// ԱϢ
+	/// עָȫַעͬ
 	/// </summary>
 	struct MemberInfo
 	{
 	public:
-		MemberInfo(const std::string& name, Interview interview, RTTRInfo* info);
+		MemberInfo(std::string_view name, Interview interview, RTTRInfo* info);
 
 	public:
-		const std::string name;
+		const std::string_view name;
 		const Interview interview;
 		RTTRInfo* const info;
 	};
@@ -51,7 +252,7 @@ namespace RTTR
 	struct StaticMemberInfo : public MemberInfo
 	{
 	public:
-		StaticMemberInfo(const std::string& name, Interview interview, RTTRInfo* info, const void* address);
+		StaticMemberInfo(std::string_view name, Interview interview, RTTRInfo* info, const void* address);
 
 	public:
 		/// <summary>
@@ -60,19 +261,151 @@ namespace RTTR
 		/// <typeparam name="M"></typeparam>
 		/// <returns></returns>
 		template<typename M>
-		M value() const { return *reinterpret_cast<M*>(const_cast<void*>(address)); }
+		M value() const { return cref<M>(); }
+
+		/// <summary>
+		/// ȡ̬Աãģʽ¼
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <returns></returns>
+		template<typename M>
+		M& ref() const
+		{
+			assert(isType<M>(info));
+			return *reinterpret_cast<M*>(const_cast<void*>(address));
+		}
+
+		/// <summary>
+		/// ȡ̬Աconstãģʽ¼
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <returns></returns>
+		template<typename M>
+		const M& cref() const { return ref<M>(); }
+
+		/// <summary>
+		/// þ̬Աֵֵƶֵд
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <param name="value"></param>
+		template<typename M, typename V>
+		void set(V&& value) const { ref<M>() = std::forward<V>(value); }
+
+		/// <summary>
+		/// ƾ̬ԱֵVariantRTTRVariant.cpp
+		/// </summary>
+		/// <returns>ԱͲɸʱΪ</returns>
+		Variant get() const;
+
+		/// <summary>
+		/// Variantþ̬ԱֵͲͬʱת
+		/// </summary>
+		/// <param name="value">ֵƶֵд</param>
+		/// <returns>Ͳ޷תʱfalse</returns>
+		bool set(const Variant& value) const;
+		bool set(Variant&& value) const;
 
 	public:
 		const void* const address{};
 	};
 
+	/// <summary>
+	/// ӼΪstrideĶȡoffsetĳԱдout
+	/// ƽƵĳԱmemcpyչ4ΣɱϲΪд룻Աʱmemcpy
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="objects">һ</param>
+	/// <param name="count"></param>
+	/// <param name="stride">ڶļ</param>
+	/// <param name="offset">Աƫ</param>
+	/// <param name="out">countԪ</param>
+	template<typename M>
+	static void gatherStrided(const void* objects, size_t count, size_t stride, int offset, M* out)
+	{
+		auto src{ static_cast<const unsigned char*>(objects) + offset };
+		if constexpr (std::is_trivially_copyable_v<M>)
+		{
+			if (stride == sizeof(M))
+			{
+				if (count) std::memcpy(out, src, count * sizeof(M));
+				return;
+			}
+
+			size_t i{ 0 };
+			for (; i + 4 <= count; i += 4, src += stride * 4)
+			{
+				std::memcpy(out + i, src, sizeof(M));
+				std::memcpy(out + i + 1, src + stride, sizeof(M));
+				std::memcpy(out + i + 2, src + stride * 2, sizeof(M));
+				std::memcpy(out + i + 3, src + stride * 3, sizeof(M));
+			}
+			for (; i < count; ++i, src += stride) std::memcpy(out + i, src, sizeof(M));
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i, src += stride) out[i] = *reinterpret_cast<const M*>(src);
+		}
+	}
+
+	/// <summary>
+	/// inֵдؼΪstrideĶoffsetĳԱ
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="objects">һ</param>
+	/// <param name="count"></param>
+	/// <param name="stride">ڶļ</param>
+	/// <param name="offset">Աƫ</param>
+	/// <param name="in">countԪ</param>
+	template<typename M>
+	static void scatterStrided(void* objects, size_t count, size_t stride, int offset, const M* in)
+	{
+		auto dst{ static_cast<unsigned char*>(objects) + offset };
+		if constexpr (std::is_trivially_copyable_v<M>)
+		{
+			if (stride == sizeof(M))
+			{
+				if (count) std::memcpy(dst, in, count * sizeof(M));
+				return;
+			}
+
+			size_t i{ 0 };
+			for (; i + 4 <= count; i += 4, dst += stride * 4)
+			{
+				std::memcpy(dst, in + i, sizeof(M));
+				std::memcpy(dst + stride, in + i + 1, sizeof(M));
+				std::memcpy(dst + stride * 2, in + i + 2, sizeof(M));
+				std::memcpy(dst + stride * 3, in + i + 3, sizeof(M));
+			}
+			for (; i < count; ++i, dst += stride) std::memcpy(dst, in + i, sizeof(M));
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i, dst += stride) *reinterpret_cast<M*>(dst) = in[i];
+		}
+	}
+
+	/// <summary>
+	/// ڶıλбһԱ
+	/// </summary>
+	/// <param name="o"></param>
+	/// <param name="dirtyOffset">λԶʼַƫƣΪ-1ʱ</param>
+	/// <param name="ordinal">Ա</param>
+	static void markDirty(void* o, int dirtyOffset, uint32_t ordinal)
+	{
+		if (dirtyOffset < 0) return;
+
+		auto words{ reinterpret_cast<uint64_t*>(static_cast<unsigned char*>(o) + dirtyOffset) };
+		words[ordinal / 64] |= uint64_t{ 1 } << (ordinal % 64);
+	}
+
 	/// <summary>
 	/// ͨԱϢ
+	/// ñʱͨset()scatter()дڶıλбǸóԱͨref()д벻
 	/// </summary>
 	struct NormalMemberInfo : public MemberInfo
 	{
 	public:
-		NormalMemberInfo(const std::string& name, Interview interview, RTTRInfo* info, int offset);
+		NormalMemberInfo(std::string_view name, Interview interview, RTTRInfo* info, int offset, int dirtyOffset = -1, uint32_t ordinal = 0);
 
 	public:
 		/// <summary>
@@ -82,23 +415,229 @@ namespace RTTR
 		/// <param name="o"></param>
 		/// <returns></returns>
 		template<typename M>
-		M value(void* o) const { return *reinterpret_cast<M*>((reinterpret_cast<unsigned char*>(o) + offset)); }
+		M value(void* o) const { return cref<M>(o); }
+
+		/// <summary>
+		/// ȡͨԱãģʽ¼
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <param name="o"></param>
+		/// <returns></returns>
+		template<typename M>
+		M& ref(void* o) const
+		{
+			assert(o && isType<M>(info));
+			return *reinterpret_cast<M*>(reinterpret_cast<unsigned char*>(o) + offset);
+		}
+
+		/// <summary>
+		/// ȡͨԱconstãģʽ¼
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <param name="o"></param>
+		/// <returns></returns>
+		template<typename M>
+		const M& cref(const void* o) const { return ref<M>(const_cast<void*>(o)); }
+
+		/// <summary>
+		/// ͨԱֵֵƶֵд
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <param name="o"></param>
+		/// <param name="value"></param>
+		template<typename M, typename V>
+		void set(void* o, V&& value) const
+		{
+			ref<M>(o) = std::forward<V>(value);
+			markDirty(o);
+		}
+
+		/// <summary>
+		/// ͨԱֵVariantRTTRVariant.cpp
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns>ԱͲɸʱΪ</returns>
+		Variant get(const void* o) const;
+
+		/// <summary>
+		/// VariantͨԱֵͲͬʱת
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="value">ֵƶֵд</param>
+		/// <returns>Ͳ޷תʱfalse</returns>
+		bool set(void* o, const Variant& value) const;
+		bool set(void* o, Variant&& value) const;
+
+		/// <summary>
+		/// ӶȡóԱģʽ¼
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <param name="objects">һ</param>
+		/// <param name="count"></param>
+		/// <param name="stride">ڶļͨΪ͵RTTRInfo::size()</param>
+		/// <param name="out">countԪ</param>
+		template<typename M>
+		void gather(const void* objects, size_t count, size_t stride, M* out) const
+		{
+			assert((objects || !count) && isType<M>(info));
+			gatherStrided(objects, count, stride, offset, out);
+		}
+
+		/// <summary>
+		/// ֵдضеĸóԱģʽ¼
+		/// </summary>
+		/// <typeparam name="M"></typeparam>
+		/// <param name="objects">һ</param>
+		/// <param name="count"></param>
+		/// <param name="stride">ڶļͨΪ͵RTTRInfo::size()</param>
+		/// <param name="in">countԪ</param>
+		template<typename M>
+		void scatter(void* objects, size_t count, size_t stride, const M* in) const
+		{
+			assert((objects || !count) && isType<M>(info));
+			scatterStrided(objects, count, stride, offset, in);
+			if (dirtyOffset >= 0)
+				for (size_t i = 0; i < count; ++i) markDirty(static_cast<unsigned char*>(objects) + i * stride);
+		}
+
+		/// <summary>
+		/// ڶıλбǸóԱδñʱκ
+		/// </summary>
+		/// <param name="o"></param>
+		void markDirty(void* o) const { RTTR::markDirty(o, dirtyOffset, ordinal); }
+
+		/// <summary>
+		/// óԱǷѱΪ޸
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns>δñʱfalse</returns>
+		bool dirty(const void* o) const
+		{
+			if (dirtyOffset < 0) return false;
+
+			auto words{ reinterpret_cast<const uint64_t*>(static_cast<const unsigned char*>(o) + dirtyOffset) };
+			return (words[ordinal / 64] >> (ordinal % 64)) & 1;
+		}
 
 	public:
 		const int offset{ 0 };
+		const int dirtyOffset{ -1 };		//͵ıλƫƣδñʱΪ-1
+		const uint32_t ordinal{ 0 };		//еעţλеλ
 	};
 
+	/// <summary>
+	/// Ͳĵ
+	/// selfΪָ(̬)args[i]ָiretָδʼķֵ洢
+	/// ֵretԭع죬÷ֵָʽţretΪnullptrʱֵ
+	/// </summary>
+	using Invoker = void(*)(void* self, void** args, void* ret);
+
+	/// <summary>
+	/// ȡģ
+	/// </summary>
+	/// <typeparam name="F"></typeparam>
+	template<typename F>
+	struct function_traits {};
+
+	template<typename R, typename... Args>
+	struct function_traits<R(*)(Args...)>
+	{
+		using return_t = R;
+		using class_t = void;
+		using args_t = std::tuple<Args...>;
+	};
+
+	template<typename R, typename C, typename... Args>
+	struct function_traits<R(C::*)(Args...)>
+	{
+		using return_t = R;
+		using class_t = C;
+		using args_t = std::tuple<Args...>;
+	};
+
+	template<typename R, typename C, typename... Args>
+	struct function_traits<R(C::*)(Args...) const>
+	{
+		using return_t = R;
+		using class_t = const C;
+		using args_t = std::tuple<Args...>;
+	};
+
+	/// <summary>
+	/// ͲĲָȡ
+	/// </summary>
+	/// <typeparam name="Arg"></typeparam>
+	/// <param name="arg"></param>
+	/// <returns>ֵؿòԭ</returns>
+	template<typename Arg>
+	static Arg unpackArg(void* arg) { return static_cast<Arg>(*static_cast<std::remove_reference_t<Arg>*>(arg)); }
+
+	template<auto F, size_t... I>
+	static void invokeUnpacked(void* self, [[maybe_unused]] void** args, void* ret, std::index_sequence<I...>)
+	{
+		using Traits = function_traits<decltype(F)>;
+		using R = typename Traits::return_t;
+		using Args = typename Traits::args_t;
+
+		auto call{ [&]() -> R
+			{
+				if constexpr (std::is_void_v<typename Traits::class_t>) return F(unpackArg<std::tuple_element_t<I, Args>>(args[I])...);
+				else return std::invoke(F, static_cast<typename Traits::class_t*>(self), unpackArg<std::tuple_element_t<I, Args>>(args[I])...);
+			} };
+
+		if constexpr (std::is_void_v<R>) call();
+		else if constexpr (std::is_reference_v<R>)
+		{
+			auto& result{ call() };
+			if (ret) new (ret) std::remove_reference_t<R>*{ &result };
+		}
+		else if (ret) new (ret) R(call());
+		else call();
+	}
+
+	/// <summary>
+	/// ΪFͲĵ
+	/// </summary>
+	/// <typeparam name="F">ָԱָ볣</typeparam>
+	template<auto F>
+	static void invoker(void* self, void** args, void* ret)
+	{
+		invokeUnpacked<F>(self, args, ret, std::make_index_sequence<std::tuple_size_v<typename function_traits<decltype(F)>::args_t>>{});
+	}
+
 	/// <summary>
 	/// Ϣ
+	/// ƽעָȫַϢָ̬
 	/// </summary>
 	struct MethodInfo
 	{
+	public:
+		/// <summary>
+		/// ⺯ָԱָĴ洢С
+		/// </summary>
+		static constexpr size_t CallableSize{ 4 * sizeof(void*) };
+
 	public:
 		template<typename F>
-		MethodInfo(const std::string& name, Interview interview, RTTRInfo* returnInfo, F callable, const std::list<RTTRInfo*>& args) :
-			name(name), interview(interview), returnInfo(returnInfo), callable(callable), args(args), address(*reinterpret_cast<void**>(&callable))
+		MethodInfo(std::string_view name, Interview interview, RTTRInfo* returnInfo, F callable, Invoker invoker, std::span<RTTRInfo* const> args) :
+			name(name), interview(interview), returnInfo(returnInfo), invoker(invoker), callableType(&typeid(F)), args(args), address(*reinterpret_cast<void**>(&callable)), signature(signature_traits<F>::value)
+		{
+			static_assert(sizeof(F) <= CallableSize && std::is_trivially_copyable_v<F>, "Unsupported callable");
+			new (this->callable) F(callable);
+
+			assert(!this->name.empty() && this->interview && this->returnInfo && this->invoker && this->address);
+		}
+
+		/// <summary>
+		/// ƷϢ滻֣עʱڸַָеֲ¼
+		/// </summary>
+		/// <param name="other"></param>
+		/// <param name="name"></param>
+		/// <param name="owner"></param>
+		MethodInfo(const MethodInfo& other, std::string_view name, const RTTRInfo* owner) :
+			name(name), interview(other.interview), returnInfo(other.returnInfo), invoker(other.invoker), callableType(other.callableType), args(other.args), address(other.address), signature(other.signature), owner(owner)
 		{
-			assert(!this->name.empty() && this->interview && this->returnInfo && this->callable.has_value() && this->address);
+			std::copy(std::begin(other.callable), std::end(other.callable), callable);
 		}
 
 	public:
@@ -108,17 +647,73 @@ namespace RTTR
 		/// <typeparam name="F"></typeparam>
 		/// <typeparam name="...Args"></typeparam>
 		/// <param name="...args"></param>
-		/// <returns></returns>
+		/// <returns>FעʱĺͲʱ׳std::bad_function_call</returns>
 		template<typename F, typename... Args>
-		decltype(auto) invoke(Args... args) const { return std::invoke(std::any_cast<F>(callable), std::forward<Args>(args)...); }
+		decltype(auto) invoke(Args... args) const
+		{
+			//ǩָƲ࣬಻ͬͬǩֻɺ֣汾ͬ
+			auto typed{ callableAs<F>() };
+			if (nullptr == typed) throw std::bad_function_call{};
+
+			RTTR_PROFILE_CALL(*this);
+			return std::invoke(*typed, std::forward<Args>(args)...);
+		}
+
+		/// <summary>
+		/// ͨͲĵڵ÷÷֪
+		/// </summary>
+		/// <param name="self">󣬾̬nullptr</param>
+		/// <param name="args">ָ</param>
+		/// <param name="ret">ֵ洢Ϊnullptr</param>
+		void call(void* self, void** args, void* ret) const
+		{
+			RTTR_PROFILE_CALL(*this);
+			invoker(self, args, ret);
+		}
+
+		/// <summary>
+		/// VariantؽͲͬʱתRTTRVariant.cpp
+		/// Variant::InlineArgsҷֵɷVariantڲ洢ʱڴ
+		/// </summary>
+		/// <param name="self">󣬾̬nullptr</param>
+		/// <param name="args"></param>
+		/// <returns>ͲƥʱΪգvoidسvoidVariant</returns>
+		Variant call(void* self, std::span<const Variant> args) const;
+
+		/// <summary>
+		/// ܷ񴫸÷
+		/// </summary>
+		/// <param name="args"></param>
+		/// <param name="exact">ΪtrueʱҪһ£ת</param>
+		/// <returns></returns>
+		bool accepts(std::span<const Variant> args, bool exact) const;
+
+		/// <summary>
+		/// ԺFȡɵö
+		/// </summary>
+		/// <typeparam name="F"></typeparam>
+		/// <returns>Ͳʱnullptr</returns>
+		template<typename F>
+		const F* callableAs() const
+		{
+			//ͬһģtypeidͬһȱȽϵַģʱٱȽ
+			if (callableType != &typeid(F) && *callableType != typeid(F)) return nullptr;
+			return std::launder(reinterpret_cast<const F*>(callable));
+		}
 
 	public:
-		const std::string name;
+		const std::string_view name;
 		const Interview interview;
 		RTTRInfo* const returnInfo;
-		const std::any callable;
-		const std::list<RTTRInfo*> args;
+		const Invoker invoker;
+		const std::type_info* const callableType;
+		const std::span<RTTRInfo* const> args;
 		void* const address;
+		const Signature signature;
+		const RTTRInfo* const owner{ nullptr };		//ͣעЧ
+
+	private:
+		alignas(void*) unsigned char callable[CallableSize]{};		//ָ룬޸
 	};
 
 	/// <summary>
@@ -147,4 +742,183 @@ namespace RTTR
 	public:
 		using MethodInfo::MethodInfo;
 	};
+
+	/// <summary>
+	/// memoryͲĲT
+	/// </summary>
+	template<typename T, typename... Args, size_t... I>
+	static void constructUnpacked(void* memory, [[maybe_unused]] void** args, std::index_sequence<I...>)
+	{
+		new (memory) T(unpackArg<Args>(args[I])...);
+	}
+
+	/// <summary>
+	/// 캯ͲڣselfΪδʼĴ洢
+	/// </summary>
+	template<typename T, typename... Args>
+	static void constructor(void* self, void** args, void*)
+	{
+		constructUnpacked<T, Args...>(self, args, std::index_sequence_for<Args...>{});
+	}
+
+	/// <summary>
+	/// 캯ͻ
+	/// </summary>
+	template<typename T, typename... Args>
+	static void construct(void* memory, Args... args)
+	{
+		new (memory) T(std::move(args)...);
+	}
+
+	/// <summary>
+	/// ͵ĴСvoidΪ0
+	/// </summary>
+	template<typename T>
+	constexpr size_t sizeOf()
+	{
+		if constexpr (std::is_void_v<T>) return 0;
+		else return sizeof(T);
+	}
+
+	/// <summary>
+	/// ͵Ķ룬voidΪ1
+	/// </summary>
+	template<typename T>
+	constexpr size_t alignmentOf()
+	{
+		if constexpr (std::is_void_v<T>) return 1;
+		else return alignof(T);
+	}
+
+	/// <summary>
+	/// TֵǷֻֽھƽû䣬λȽ
+	/// long double䣬ڴ
+	/// </summary>
+	template<typename T>
+	constexpr bool bytewise()
+	{
+		if constexpr (std::is_void_v<T>) return false;
+		else return std::is_trivially_copyable_v<T> && (std::has_unique_object_representations_v<T> || (std::is_floating_point_v<T> && sizeof(T) <= sizeof(double)));
+	}
+
+	/// <summary>
+	/// oTͲӦߵ
+	/// </summary>
+	template<typename T>
+	static void destruct([[maybe_unused]] void* o)
+	{
+		if constexpr (std::is_destructible_v<T>) static_cast<T*>(o)->~T();
+		else assert(false);
+	}
+
+	/// <summary>
+	/// memoryoƹT
+	/// </summary>
+	/// <returns>Tɸʱfalse</returns>
+	template<typename T>
+	static bool copyConstruct([[maybe_unused]] void* memory, [[maybe_unused]] const void* o)
+	{
+		if constexpr (std::is_copy_constructible_v<T>)
+		{
+			new (memory) T(*static_cast<const T*>(o));
+			return true;
+		}
+		else return false;
+	}
+
+	/// <summary>
+	/// memoryoƶT
+	/// </summary>
+	/// <returns>Tƶʱfalse</returns>
+	template<typename T>
+	static bool moveConstruct([[maybe_unused]] void* memory, [[maybe_unused]] void* o)
+	{
+		if constexpr (std::is_move_constructible_v<T>)
+		{
+			new (memory) T(std::move(*static_cast<T*>(o)));
+			return true;
+		}
+		else return false;
+	}
+
+	/// <summary>
+	/// valueƸֵoT
+	/// </summary>
+	/// <returns>TɸƸֵʱfalse</returns>
+	template<typename T>
+	static bool copyAssign([[maybe_unused]] void* o, [[maybe_unused]] const void* value)
+	{
+		if constexpr (std::is_copy_assignable_v<T>)
+		{
+			*static_cast<T*>(o) = *static_cast<const T*>(value);
+			return true;
+		}
+		else return false;
+	}
+
+	/// <summary>
+	/// valueƶֵoT
+	/// </summary>
+	/// <returns>Tƶֵʱfalse</returns>
+	template<typename T>
+	static bool moveAssign([[maybe_unused]] void* o, [[maybe_unused]] void* value)
+	{
+		if constexpr (std::is_move_assignable_v<T>)
+		{
+			*static_cast<T*>(o) = std::move(*static_cast<T*>(value));
+			return true;
+		}
+		else return false;
+	}
+
+	/// <summary>
+	/// 캯Ϣ
+	/// ڵ÷ṩδʼ洢Ϲǩָvoidͼ
+	/// </summary>
+	struct ConstructorInfo
+	{
+	public:
+		/// <summary>
+		/// TArgsĹ캯ϢRTTRInfo.h
+		/// </summary>
+		/// <typeparam name="...Args"></typeparam>
+		/// <typeparam name="T"></typeparam>
+		/// <param name="interview"></param>
+		/// <returns></returns>
+		template<typename... Args, typename T>
+		static ConstructorInfo of(Interview interview, std::type_identity<T>);
+
+	public:
+		ConstructorInfo(Interview interview, Invoker invoker, void (*callable)(), const std::type_info* callableType, std::span<RTTRInfo* const> args, Signature signature);
+
+	public:
+		/// <summary>
+		/// Բ죬עʱһ
+		/// </summary>
+		/// <param name="memory">δʼĴ洢</param>
+		/// <param name="...args"></param>
+		/// <returns>עʱʱ׳std::bad_function_call</returns>
+		template<typename... Args>
+		void construct(void* memory, Args&&... args) const
+		{
+			using F = void(*)(void*, std::remove_cvref_t<Args>...);
+			if (*callableType != typeid(F)) throw std::bad_function_call{};
+			reinterpret_cast<F>(callable)(memory, std::forward<Args>(args)...);
+		}
+
+		/// <summary>
+		/// ͲĲ
+		/// </summary>
+		/// <param name="memory">δʼĴ洢</param>
+		/// <param name="args">ָ</param>
+		void call(void* memory, void** args) const { invoker(memory, args, nullptr); }
+
+	public:
+		const Interview interview;
+		const Invoker invoker;
+		void (* const callable)();					//ͻڣcallableTypeԭ
+		const std::type_info* const callableType;
+		const std::span<RTTRInfo* const> args;
+		const Signature signature;
+	};
 }
@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <cstring>
+
+#include "RTTRDiff.hpp"
+#include "RTTRDirty/RTTRDirty.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ȽValueֶʱлĻ壬ڶαȽ֮临
+	/// </summary>
+	static thread_local BinaryWriter t_base{};
+	static thread_local BinaryWriter t_target{};
+
+	/// <summary>
+	/// дֶֶεֵǶ׶дȫֶ
+	/// </summary>
+	/// <param name="field"></param>
+	/// <param name="index">ֶ</param>
+	/// <param name="o"></param>
+	/// <param name="writer"></param>
+	static void writeField(const DiffPlan::Field& field, uint16_t index, const unsigned char* o, BinaryWriter& writer)
+	{
+		auto value{ o + field.offset };
+		writer.write(index);
+
+		switch (field.kind)
+		{
+		case DiffPlan::Bytes:
+			writer.write(value, field.size);
+			break;
+
+		case DiffPlan::Nested:
+		{
+			const auto& plan{ field.info->plan<DiffPlan>(&DiffPlan::build) };
+			for (size_t i = 0; i < plan.fields.size(); ++i) writeField(plan.fields[i], static_cast<uint16_t>(i), value, writer);
+			writer.write(DiffPlan::End);
+			break;
+		}
+
+		default:
+			field.info->serialize(value, writer);
+			break;
+		}
+	}
+
+	/// <summary>
+	/// ȽһֶΣ仯ʱдֵֶ
+	/// </summary>
+	/// <param name="field"></param>
+	/// <param name="index">ֶ</param>
+	/// <param name="base">ɶ</param>
+	/// <param name="target">¶</param>
+	/// <param name="writer"></param>
+	/// <returns>Ƿ仯</returns>
+	static bool diffField(const DiffPlan::Field& field, uint16_t index, const unsigned char* base, const unsigned char* target, BinaryWriter& writer)
+	{
+		base += field.offset;
+		target += field.offset;
+
+		switch (field.kind)
+		{
+		case DiffPlan::Bytes:
+			if (0 == std::memcmp(base, target, field.size)) return false;
+
+			writer.write(index);
+			writer.write(target, field.size);
+			return true;
+
+		case DiffPlan::Nested:
+		{
+			//Ƕ׶ûб仯ʱд
+			auto mark{ writer.size() };
+			writer.write(index);
+			if (diff(*field.info, base, target, writer)) return true;
+
+			writer.truncate(mark);
+			return false;
+		}
+
+		default:
+			t_base.clear();
+			t_target.clear();
+			field.info->serialize(base, t_base);
+			field.info->serialize(target, t_target);
+			if (t_base.size() == t_target.size() && 0 == std::memcmp(t_base.data(), t_target.data(), t_base.size())) return false;
+
+			writer.write(index);
+			writer.write(t_target.data(), t_target.size());
+			return true;
+		}
+	}
+
+	/// <summary>
+	/// ǷעͨԱ
+	/// </summary>
+	/// <param name="info"></param>
+	/// <returns></returns>
+	static bool hasNormalMembers(const RTTRInfo& info)
+	{
+		return std::any_of(info.ancestors().begin(), info.ancestors().end(), [](const Ancestor& ancestor) { return !ancestor.info->normalMembers().empty(); });
+	}
+}
+
+RTTR::DiffPlan RTTR::DiffPlan::build(const RTTRInfo& info)
+{
+	DiffPlan plan{};
+
+	//ͨԱĳԱƫƼڶеƫ
+	struct Member
+	{
+		const NormalMemberInfo* info;
+		int offset;
+		bool own;		//ĳԱλֻ¼ЩԱ
+	};
+	std::vector<Member> members{};
+	for (const auto& ancestor : info.ancestors())
+	{
+		if (ancestor.offset == Superclass::UnknownOffset)
+		{
+			assert(ancestor.info->normalMembers().empty() && "A virtual or ambiguous superclass has normal members that cannot be located in the object");
+			continue;
+		}
+		for (const auto& member : ancestor.info->normalMembers()) members.push_back({ &member, static_cast<int>(ancestor.offset) + member.offset, ancestor.info == &info });
+	}
+	std::stable_sort(members.begin(), members.end(), [](const Member& lhs, const Member& rhs) { return lhs.offset < rhs.offset; });
+
+	if (members.empty())
+	{
+		plan.fields.push_back({ 0, info.size(), &info, info.trivial() ? Bytes : Value });
+		plan.runs.push_back({ 0, 1, 0, info.trivial() ? info.size() : 0 });
+		return plan;
+	}
+
+	assert(members.size() < End);
+	for (auto [member, offset, own] : members)
+	{
+		auto trivial{ member->info->trivial() };
+		auto size{ member->info->size() };
+		auto index{ static_cast<uint32_t>(plan.fields.size()) };
+		plan.fields.push_back({ offset, size, member->info, hasNormalMembers(*member->info) ? Nested : trivial ? Bytes : Value });
+
+		if (own)
+		{
+			if (member->ordinal >= plan.fieldOf.size()) plan.fieldOf.resize(member->ordinal + 1, End);
+			plan.fieldOf[member->ordinal] = static_cast<uint16_t>(index);
+		}
+
+		//һεĿƽƳԱö
+		if (trivial && !plan.runs.empty() && plan.runs.back().size && plan.runs.back().offset + static_cast<int>(plan.runs.back().size) == offset)
+		{
+			plan.runs.back().end = index + 1;
+			plan.runs.back().size += size;
+		}
+		else
+			plan.runs.push_back({ index, index + 1, offset, trivial ? size : 0 });
+	}
+	return plan;
+}
+
+size_t RTTR::diff(const RTTRInfo& info, const void* base, const void* target, BinaryWriter& writer)
+{
+	assert(base != nullptr && target != nullptr);
+
+	const auto& plan{ info.plan<DiffPlan>(&DiffPlan::build) };
+	auto from{ static_cast<const unsigned char*>(base) };
+	auto to{ static_cast<const unsigned char*>(target) };
+
+	size_t changed{ 0 };
+	for (const auto& run : plan.runs)
+	{
+		//ͬʱֶΣֻһֶεĶdiffFieldȽ
+		if (run.size && run.end - run.begin > 1 && 0 == std::memcmp(from + run.offset, to + run.offset, run.size)) continue;
+
+		for (auto i = run.begin; i < run.end; ++i) changed += diffField(plan.fields[i], static_cast<uint16_t>(i), from, to, writer);
+	}
+
+	writer.write(DiffPlan::End);
+	return changed;
+}
+
+bool RTTR::applyPatch(const RTTRInfo& info, void* o, BinaryReader& reader)
+{
+	assert(o != nullptr);
+
+	const auto& plan{ info.plan<DiffPlan>(&DiffPlan::build) };
+	auto object{ static_cast<unsigned char*>(o) };
+
+	uint16_t index{ 0 };
+	while (reader.read(index))
+	{
+		if (DiffPlan::End == index) return true;
+		if (index >= plan.fields.size()) return false;
+
+		const auto& field{ plan.fields[index] };
+		auto value{ object + field.offset };
+		switch (field.kind)
+		{
+		case DiffPlan::Bytes:
+			if (!reader.read(value, field.size)) return false;
+			break;
+
+		case DiffPlan::Nested:
+			if (!applyPatch(*field.info, value, reader)) return false;
+			break;
+
+		default:
+			if (!field.info->deserialize(value, reader)) return false;
+			break;
+		}
+	}
+	return false;
+}
+
+size_t RTTR::writeDirty(const RTTRInfo& info, const void* o, BinaryWriter& writer)
+{
+	assert(o != nullptr);
+
+	const auto& plan{ info.plan<DiffPlan>(&DiffPlan::build) };
+	auto object{ static_cast<const unsigned char*>(o) };
+
+	size_t written{ 0 };
+	forEachBit(info.dirtyBits(o), [&plan, object, &writer, &written](uint32_t ordinal)
+		{
+			//ƻ֮עĳԱڼƻ
+			if (ordinal >= plan.fieldOf.size() || DiffPlan::End == plan.fieldOf[ordinal]) return;
+
+			auto index{ plan.fieldOf[ordinal] };
+			writeField(plan.fields[index], index, object, writer);
+			++written;
+		});
+
+	writer.write(DiffPlan::End);
+	return written;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "RTTRInfo/RTTRInfo.h"
+#include "RTTRSerialize/RTTRSerialize.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ƻƫͨԱɶλԱżеֶ
+	/// ڵĿƽƳԱϲΪһΣͬʱһmemcmp
+	/// </summary>
+	struct DiffPlan
+	{
+	public:
+		/// <summary>
+		/// ֶεıȽϷʽ
+		/// </summary>
+		enum Kind : uint8_t
+		{
+			Bytes,			//ƽƵֵֽڱȽд
+			Nested,			//עͨԱͣݹɲ
+			Value,			//ͣȽлдл
+		};
+
+		struct Field
+		{
+		public:
+			int offset;
+			size_t size;
+			const RTTRInfo* info;
+			Kind kind;
+		};
+
+		/// <summary>
+		/// ֶ[begin, end)sizeΪ0ʱЩֶοƽڶн
+		/// </summary>
+		struct Run
+		{
+		public:
+			uint32_t begin;
+			uint32_t end;
+			int offset;
+			size_t size;
+		};
+
+	public:
+		/// <summary>
+		/// бʾֶνţֶСڸֵ
+		/// </summary>
+		static constexpr uint16_t End{ UINT16_MAX };
+
+		/// <summary>
+		/// Ϣƻ
+		/// ûעͨԱΪһֶ
+		/// ƻ״ʹʱ˺Ǽǵĸ಻Ტ
+		/// </summary>
+		/// <param name="info"></param>
+		/// <returns></returns>
+		static DiffPlan build(const RTTRInfo& info);
+
+	public:
+		std::vector<Field> fields{};
+		std::vector<Run> runs{};
+		std::vector<uint16_t> fieldOf{};	//ͨԱעȡֶ
+	};
+
+	/// <summary>
+	/// дbaseΪtargetĲ죬ʽΪ(uint16ֶ, ֵ)DiffPlan::End
+	/// Ƕ͵ֵĲ죬ֶεֵлʽͬ
+	/// ֶȡעĳԱ˫עͬĳԱ
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="base">Էеľɶ</param>
+	/// <param name="target">¶</param>
+	/// <param name="writer"></param>
+	/// <returns>仯ֶΪ0ʱֻд</returns>
+	size_t diff(const RTTRInfo& info, const void* base, const void* target, BinaryWriter& writer);
+
+	/// <summary>
+	/// ԭظ¶δ仯ֶβ
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o">ɲʱbaseͬĶ</param>
+	/// <param name="reader"></param>
+	/// <returns>ݲֶЧʱfalseʱڲָµ״̬</returns>
+	bool applyPatch(const RTTRInfo& info, void* o, BinaryReader& reader);
+
+	/// <summary>
+	/// λд죬ֻʱǵĳԱʽdiff()ͬapplyPatch()Ӧ
+	/// ǵǶ׶дȫֶΣǣдɵ÷clearDirty()
+	/// </summary>
+	/// <param name="info">Ϣñ</param>
+	/// <param name="o"></param>
+	/// <param name="writer"></param>
+	/// <returns>дֶ</returns>
+	size_t writeDirty(const RTTRInfo& info, const void* o, BinaryWriter& writer);
+
+	/// <summary>
+	/// дbaseΪtargetĲ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <returns>仯ֶ</returns>
+	template<typename T>
+	static size_t diff(const T& base, const T& target, BinaryWriter& writer) { return diff(*RealRTTRInfo<T>::instance(), &base, &target, writer); }
+
+	/// <summary>
+	/// ԭظ¶
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <returns>ݲֶЧʱfalse</returns>
+	template<typename T>
+	static bool applyPatch(T& value, BinaryReader& reader) { return applyPatch(*RealRTTRInfo<T>::instance(), &value, reader); }
+}
@@ -0,0 +1,12 @@
+#include "RTTRDirty.hpp"
+
+RTTR::DirtyPlan RTTR::DirtyPlan::build(const RTTRInfo& info)
+{
+	DirtyPlan plan{};
+	for (const auto& member : info.normalMembers())
+	{
+		assert(member.ordinal == plan.members.size());
+		plan.members.push_back(&member);
+	}
+	return plan;
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "RTTRInfo/RTTRInfo.h"
+
+namespace RTTR
+{
+	/// <summary>
+	/// λŴСλΪ1λ
+	/// </summary>
+	/// <param name="words"></param>
+	/// <param name="f">f(uint32_tλ)</param>
+	template<typename F>
+	static void forEachBit(std::span<const uint64_t> words, F&& f)
+	{
+		for (size_t i = 0; i < words.size(); ++i)
+			for (auto word{ words[i] }; word; word &= word - 1) f(static_cast<uint32_t>(i * 64 + std::countr_zero(word)));
+	}
+
+	/// <summary>
+	/// ǶıλiλӦעΪiͨԱ
+	/// RTTR_REGISTER_DIRTY_BITSǼǺͨset()scatter()ԱдʱԶ
+	/// ǲԭӲͬһĲдɵ÷ͬдԱͬ
+	/// </summary>
+	/// <typeparam name="N">λڸٵͨԱ</typeparam>
+	template<size_t N = 64>
+	class DirtyBits
+	{
+	public:
+		static constexpr size_t Capacity{ N };
+
+	public:
+		/// <summary>
+		/// ǷгԱ
+		/// </summary>
+		/// <returns></returns>
+		bool any() const
+		{
+			for (auto word : m_words)
+				if (word) return true;
+			return false;
+		}
+
+		bool test(uint32_t ordinal) const { assert(ordinal < N); return (m_words[ordinal / 64] >> (ordinal % 64)) & 1; }
+		void mark(uint32_t ordinal) { assert(ordinal < N); m_words[ordinal / 64] |= uint64_t{ 1 } << (ordinal % 64); }
+		void clear() { m_words.fill(0); }
+
+		/// <summary>
+		/// עűǵĳԱ
+		/// </summary>
+		/// <param name="f">f(uint32_tע)</param>
+		template<typename F>
+		void forEach(F&& f) const { forEachBit(m_words, std::forward<F>(f)); }
+
+	private:
+		std::array<uint64_t, (N + 63) / 64> m_words{};
+	};
+
+	/// <summary>
+	/// עеͨԱλʱֱӰȡԱϢ
+	/// </summary>
+	struct DirtyPlan
+	{
+	public:
+		/// <summary>
+		/// Ϣ
+		/// </summary>
+		/// <param name="info"></param>
+		/// <returns></returns>
+		static DirtyPlan build(const RTTRInfo& info);
+
+	public:
+		std::vector<const NormalMemberInfo*> members{};
+	};
+
+	/// <summary>
+	/// עűбΪ޸ĵͨԱδñʱf
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o"></param>
+	/// <param name="f">f(const NormalMemberInfo&)</param>
+	template<typename F>
+	static void forEachDirty(const RTTRInfo& info, const void* o, F&& f)
+	{
+		const auto& plan{ info.plan<DirtyPlan>(&DirtyPlan::build) };
+		forEachBit(info.dirtyBits(o), [&plan, &f](uint32_t ordinal)
+			{
+				//ƻ֮עĳԱڼƻ
+				if (ordinal < plan.members.size()) f(*plan.members[ordinal]);
+			});
+	}
+
+	/// <summary>
+	/// ǷгԱΪ޸
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o"></param>
+	/// <returns>δñʱfalse</returns>
+	inline bool anyDirty(const RTTRInfo& info, const void* o)
+	{
+		for (auto word : info.dirtyBits(o))
+			if (word) return true;
+		return false;
+	}
+
+	/// <summary>
+	/// бǣͨд֮
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o"></param>
+	inline void clearDirty(const RTTRInfo& info, void* o)
+	{
+		for (auto& word : info.dirtyBits(o)) word = 0;
+	}
+
+	/// <summary>
+	/// ԱָȡͨԱϢ״εʱҲ
+	/// </summary>
+	/// <typeparam name="Pointer">&T::Name</typeparam>
+	/// <returns>Աδעʱnullptr</returns>
+	template<auto Pointer>
+	static const NormalMemberInfo* normalMemberOf()
+	{
+		using traits = member_traits<decltype(Pointer)>;
+
+		static const NormalMemberInfo* s_member{ []() -> const NormalMemberInfo*
+			{
+				for (const auto& member : RealRTTRInfo<typename traits::class_t>::instance()->normalMembers())
+					if (member.offset == memberOffset<Pointer>() && isType<typename traits::value_t>(member.info)) return &member;
+				return nullptr;
+			}() };
+		return s_member;
+	}
+
+	/// <summary>
+	/// ǳԱΪ޸ģڲֱдԱ֮
+	/// </summary>
+	/// <typeparam name="Pointer">&T::Name</typeparam>
+	/// <param name="o"></param>
+	template<auto Pointer>
+	static void markDirty(typename member_traits<decltype(Pointer)>::class_t& o)
+	{
+		if (auto member{ normalMemberOf<Pointer>() }) member->markDirty(&o);
+	}
+
+	/// <summary>
+	/// дԱΪ޸ģԼsetterдֱӸֵ
+	///  void setX(float x) { RTTR::setTracked<&Foo::m_x>(*this, x); }
+	/// </summary>
+	/// <typeparam name="Pointer">&T::Name</typeparam>
+	/// <param name="o"></param>
+	/// <param name="value">ֵƶֵд</param>
+	template<auto Pointer, typename V>
+	static void setTracked(typename member_traits<decltype(Pointer)>::class_t& o, V&& value)
+	{
+		o.*Pointer = std::forward<V>(value);
+		markDirty<Pointer>(o);
+	}
+}
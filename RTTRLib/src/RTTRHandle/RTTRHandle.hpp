@@ -0,0 +1,326 @@
+#pragma once
+
+#include "RTTRInvoke/RTTRInvoke.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// 
+	/// ǩֻڴʱһΣinvokeʱַ
+	/// </summary>
+	/// <typeparam name="F"></typeparam>
+	template<typename F>
+	class MethodHandle {};
+
+	template<typename R, typename... Args>
+	class MethodHandle<R(*)(Args...)>
+	{
+	public:
+		using function_t = R(*)(Args...);
+
+	public:
+		MethodHandle() = default;
+		explicit MethodHandle(function_t callable) : m_callable(callable) {}
+
+	public:
+		explicit operator bool() const { return m_callable != nullptr; }
+
+		/// <summary>
+		/// þ̬
+		/// </summary>
+		/// <param name="...args"></param>
+		/// <returns></returns>
+		R invoke(Args... args) const
+		{
+			assert(m_callable);
+			return m_callable(std::forward<Args>(args)...);
+		}
+
+	private:
+		function_t m_callable{};
+	};
+
+	template<typename R, typename C, typename... Args>
+	class MethodHandle<R(C::*)(Args...)>
+	{
+	public:
+		using function_t = R(C::*)(Args...);
+
+	public:
+		MethodHandle() = default;
+		explicit MethodHandle(function_t callable) : m_callable(callable) {}
+
+	public:
+		explicit operator bool() const { return m_callable != nullptr; }
+
+		/// <summary>
+		/// ͨ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="...args"></param>
+		/// <returns></returns>
+		R invoke(void* o, Args... args) const
+		{
+			assert(m_callable && o);
+			return std::invoke(m_callable, reinterpret_cast<C*>(o), std::forward<Args>(args)...);
+		}
+
+	private:
+		function_t m_callable{};
+	};
+
+	template<typename R, typename C, typename... Args>
+	class MethodHandle<R(C::*)(Args...) const>
+	{
+	public:
+		using function_t = R(C::*)(Args...) const;
+
+	public:
+		MethodHandle() = default;
+		explicit MethodHandle(function_t callable) : m_callable(callable) {}
+
+	public:
+		explicit operator bool() const { return m_callable != nullptr; }
+
+		/// <summary>
+		/// const
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="...args"></param>
+		/// <returns></returns>
+		R invoke(const void* o, Args... args) const
+		{
+			assert(m_callable && o);
+			return std::invoke(m_callable, reinterpret_cast<const C*>(o), std::forward<Args>(args)...);
+		}
+
+	private:
+		function_t m_callable{};
+	};
+
+	/// <summary>
+	/// ̬Ա
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	template<typename M>
+	class StaticMemberHandle
+	{
+	public:
+		StaticMemberHandle() = default;
+		explicit StaticMemberHandle(const void* address) : m_address(address) {}
+
+	public:
+		explicit operator bool() const { return m_address != nullptr; }
+
+		/// <summary>
+		/// ȡ̬Աֵ
+		/// </summary>
+		/// <returns></returns>
+		M value() const { return cref(); }
+
+		/// <summary>
+		/// ȡ̬Ա
+		/// </summary>
+		/// <returns></returns>
+		M& ref() const
+		{
+			assert(m_address);
+			return *reinterpret_cast<M*>(const_cast<void*>(m_address));
+		}
+
+		/// <summary>
+		/// ȡ̬Աconst
+		/// </summary>
+		/// <returns></returns>
+		const M& cref() const { return ref(); }
+
+		/// <summary>
+		/// þ̬Աֵֵƶֵд
+		/// </summary>
+		/// <param name="value"></param>
+		template<typename V>
+		void set(V&& value) const { ref() = std::forward<V>(value); }
+
+	private:
+		const void* m_address{};
+	};
+
+	/// <summary>
+	/// ͨԱ
+	/// NormalMemberInfoͬͨset()scatter()дʱǱλ
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	template<typename M>
+	class NormalMemberHandle
+	{
+	public:
+		NormalMemberHandle() = default;
+		explicit NormalMemberHandle(int offset, int dirtyOffset = -1, uint32_t ordinal = 0) : m_offset(offset), m_dirtyOffset(dirtyOffset), m_ordinal(ordinal) {}
+
+	public:
+		explicit operator bool() const { return m_offset >= 0; }
+
+		/// <summary>
+		/// ȡͨԱֵ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns></returns>
+		M value(const void* o) const { return cref(o); }
+
+		/// <summary>
+		/// ȡͨԱ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns></returns>
+		M& ref(void* o) const
+		{
+			assert(m_offset >= 0 && o);
+			return *reinterpret_cast<M*>(reinterpret_cast<unsigned char*>(o) + m_offset);
+		}
+
+		/// <summary>
+		/// ȡͨԱconst
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns></returns>
+		const M& cref(const void* o) const { return ref(const_cast<void*>(o)); }
+
+		/// <summary>
+		/// ͨԱֵֵƶֵд
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="value"></param>
+		template<typename V>
+		void set(void* o, V&& value) const
+		{
+			ref(o) = std::forward<V>(value);
+			markDirty(o, m_dirtyOffset, m_ordinal);
+		}
+
+		/// <summary>
+		/// ӶȡóԱ
+		/// </summary>
+		/// <param name="objects">һ</param>
+		/// <param name="count"></param>
+		/// <param name="stride">ڶļ</param>
+		/// <param name="out">countԪ</param>
+		void gather(const void* objects, size_t count, size_t stride, M* out) const
+		{
+			assert(m_offset >= 0);
+			gatherStrided(objects, count, stride, m_offset, out);
+		}
+
+		/// <summary>
+		/// ֵдضеĸóԱ
+		/// </summary>
+		/// <param name="objects">һ</param>
+		/// <param name="count"></param>
+		/// <param name="stride">ڶļ</param>
+		/// <param name="in">countԪ</param>
+		void scatter(void* objects, size_t count, size_t stride, const M* in) const
+		{
+			assert(m_offset >= 0);
+			scatterStrided(objects, count, stride, m_offset, in);
+			if (m_dirtyOffset >= 0)
+				for (size_t i = 0; i < count; ++i) markDirty(static_cast<unsigned char*>(objects) + i * stride, m_dirtyOffset, m_ordinal);
+		}
+
+	private:
+		int m_offset{ -1 };
+		int m_dirtyOffset{ -1 };
+		uint32_t m_ordinal{ 0 };
+	};
+
+	/// <summary>
+	/// Fǩҷȡɵö
+	/// </summary>
+	/// <typeparam name="F"></typeparam>
+	/// <param name="methodInfo">ϢΪnullptr</param>
+	/// <returns></returns>
+	template<typename F, typename T>
+	static MethodHandle<F> makeMethodHandle(const T* methodInfo)
+	{
+		auto callable{ methodInfo ? methodInfo->template callableAs<F>() : nullptr };
+		return callable ? MethodHandle<F>{ *callable } : MethodHandle<F>{};
+	}
+
+	/// <summary>
+	/// ̬
+	/// </summary>
+	/// <typeparam name="F"></typeparam>
+	/// <param name="name"></param>
+	/// <param name="method"></param>
+	/// <returns>Ҳʱؿվ</returns>
+	template<typename F>
+	static MethodHandle<F> staticMethodHandle(std::string_view name, std::string_view method)
+	{
+		auto info{ RTTRInfo::info(name) };
+		return info ? makeMethodHandle<F>(info->staticMethod(method, signature_traits<F>::value)) : MethodHandle<F>{};
+	}
+
+	/// <summary>
+	/// ͨ
+	/// </summary>
+	/// <typeparam name="F"></typeparam>
+	/// <param name="name"></param>
+	/// <param name="method"></param>
+	/// <returns>Ҳʱؿվ</returns>
+	template<typename F, typename Traits = member_method_traits<F>>
+	static MethodHandle<F> normalMethodHandle(std::string_view name, std::string_view method)
+	{
+		static_assert(!Traits::is_const::value, "Method is const");
+
+		auto info{ RTTRInfo::info(name) };
+		return info ? makeMethodHandle<F>(info->normalMethod(method, signature_traits<F>::value)) : MethodHandle<F>{};
+	}
+
+	/// <summary>
+	/// const
+	/// </summary>
+	/// <typeparam name="F"></typeparam>
+	/// <param name="name"></param>
+	/// <param name="method"></param>
+	/// <returns>Ҳʱؿվ</returns>
+	template<typename F, typename Traits = member_method_traits<F>>
+	static MethodHandle<F> constMethodHandle(std::string_view name, std::string_view method)
+	{
+		static_assert(Traits::is_const::value, "Method is not const");
+
+		auto info{ RTTRInfo::info(name) };
+		return info ? makeMethodHandle<F>(info->constMethod(method, signature_traits<F>::value)) : MethodHandle<F>{};
+	}
+
+	/// <summary>
+	/// ̬Ա
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <returns>ҲԱͲMʱؿվ</returns>
+	template<typename M>
+	static StaticMemberHandle<M> staticMemberHandle(std::string_view name, std::string_view member)
+	{
+		auto info{ RTTRInfo::info(name) };
+		if (nullptr == info) return {};
+
+		auto memberInfo{ info->staticMember(member) };
+		return memberInfo && isType<M>(memberInfo->info) ? StaticMemberHandle<M>{ memberInfo->address } : StaticMemberHandle<M>{};
+	}
+
+	/// <summary>
+	/// ͨԱ
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <returns>ҲԱͲMʱؿվ</returns>
+	template<typename M>
+	static NormalMemberHandle<M> normalMemberHandle(std::string_view name, std::string_view member)
+	{
+		auto info{ RTTRInfo::info(name) };
+		if (nullptr == info) return {};
+
+		auto memberInfo{ info->normalMember(member) };
+		return memberInfo && isType<M>(memberInfo->info) ? NormalMemberHandle<M>{ memberInfo->offset, memberInfo->dirtyOffset, memberInfo->ordinal } : NormalMemberHandle<M>{};
+	}
+}
@@ -1,204 +1,1477 @@
 #include <algorithm>
-#include <unordered_map>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <vector>
 
 #include "RTTRInfo.h"
+#include "RTTRJson/RTTRJson.hpp"
+#include "RTTRPool/RTTRPool.hpp"
+#include "RTTRSerialize/RTTRSerialize.hpp"
+#include "RTTRValue/RTTRValue.hpp"
 
 namespace RTTR
 {
 	class RTTRInfoImpl
 	{
 	public:
-		struct AddressEqual
+		/// <summary>
+		/// ʱԲңϣ
+		/// Сɨŵȹϣ̽죬Ҳʡȥڴ
+		/// </summary>
+		static constexpr size_t LinearLimit{ 8 };
+
+		/// <summary>
+		/// (ѡǩ)ΪĿѰַ洢ڴ
+		/// ֻϣֵɵ÷ֵȡȽϣֵƽ
+		/// </summary>
+		template<typename V>
+		class NameIndex
+		{
+		private:
+			struct Slot
+			{
+			public:
+				size_t hash{ 0 };		//Ϊ0ʱΪղ
+				V value{};
+			};
+
+		public:
+			using Key = std::pair<std::string_view, Signature>;
+
+			static size_t hashOf(std::string_view name, Signature tag)
+			{
+				return (std::hash<std::string_view>{}(name) ^ static_cast<size_t>(tag * 0x9E3779B97F4A7C15ull)) | 1;
+			}
+
+		public:
+			/// <summary>
+			/// Ƿѽ
+			/// </summary>
+			/// <returns></returns>
+			bool built() const { return m_slots != nullptr; }
+
+			/// <summary>
+			/// 
+			/// </summary>
+			/// <param name="name"></param>
+			/// <param name="tag"></param>
+			/// <param name="keyOf">ֵȡ</param>
+			/// <returns>Ҳʱnullptr</returns>
+			template<typename KeyOf>
+			const V* find(std::string_view name, Signature tag, KeyOf keyOf) const
+			{
+				if (nullptr == m_slots) return nullptr;
+
+				auto hash{ hashOf(name, tag) };
+				for (auto i{ hash & m_mask }; ; i = (i + 1) & m_mask)
+				{
+					const auto& slot{ m_slots[i] };
+					if (0 == slot.hash) return nullptr;
+					if (slot.hash == hash && keyOf(slot.value) == Key{ name, tag }) return &slot.value;
+				}
+			}
+
+			/// <summary>
+			/// 룬÷豣֤
+			/// </summary>
+			/// <param name="name"></param>
+			/// <param name="tag"></param>
+			/// <param name="value"></param>
+			void insert(std::string_view name, Signature tag, V value)
+			{
+				if (nullptr == m_slots || (m_size + 1) * 2 > m_mask + 1)
+				{
+					auto slots{ m_slots };
+					auto capacity{ m_slots ? (m_mask + 1) * 2 : 16 };
+
+					m_slots = Arena::instance().allocate<Slot>(capacity);
+					std::uninitialized_value_construct_n(m_slots, capacity);
+					m_mask = capacity - 1;
+					for (size_t i = 0; slots && i < capacity / 2; ++i)
+						if (slots[i].hash) place(slots[i]);
+				}
+
+				place({ hashOf(name, tag), value });
+				++m_size;
+			}
+
+			/// <summary>
+			/// գ
+			/// </summary>
+			void clear()
+			{
+				if (m_slots) std::fill_n(m_slots, m_mask + 1, Slot{});
+				m_size = 0;
+			}
+
+		private:
+			void place(const Slot& slot)
+			{
+				auto i{ slot.hash & m_mask };
+				while (m_slots[i].hash) i = (i + 1) & m_mask;
+				m_slots[i] = slot;
+			}
+
+		private:
+			Slot* m_slots{ nullptr };
+			uint32_t m_mask{ 0 };
+			uint32_t m_size{ 0 };
+		};
+
+		/// <summary>
+		/// ٱ仯ּϵСϣseal()ڴвͷ
+		/// ϣͰÿͰ¼һӣͰеļٻϺǡڻͬĲ
+		/// ڼֵһڲУֻһιϣһ̽һαȽ
+		/// </summary>
+		template<typename V>
+		class PerfectIndex
+		{
+		public:
+			struct Slot
+			{
+			public:
+				std::string_view name{};
+				Signature tag{ 0 };
+				V value{};
+			};
+
+		public:
+			/// <summary>
+			/// 軥ͬ
+			/// </summary>
+			/// <param name="entries"></param>
+			/// <returns>MinSizeҲ(Ĺϣͬ)ʱnullptr</returns>
+			static const PerfectIndex* build(std::span<const Slot> entries)
+			{
+				if (entries.size() < MinSize || entries.size() > UINT32_MAX) return nullptr;
+
+				auto size{ static_cast<uint32_t>(entries.size()) };
+				auto buckets{ std::bit_ceil(size / KeysPerBucket + 1) };
+
+				//ͰĴСãͰڿղ۶ʱҵ
+				std::vector<size_t> hashes(size);
+				std::vector<uint32_t> counts(buckets + 1);
+				for (uint32_t i = 0; i < size; ++i)
+				{
+					hashes[i] = NameIndex<V>::hashOf(entries[i].name, entries[i].tag);
+					++counts[bucketOf(hashes[i], buckets - 1) + 1];
+				}
+				std::vector<uint32_t> sizes(counts.begin() + 1, counts.end());
+				for (uint32_t i = 0; i < buckets; ++i) counts[i + 1] += counts[i];
+				std::vector<uint32_t> keys(size);
+				for (uint32_t i = 0; i < size; ++i) keys[counts[bucketOf(hashes[i], buckets - 1)]++] = i;
+
+				std::vector<uint32_t> order(buckets);
+				for (uint32_t i = 0; i < buckets; ++i) order[i] = i;
+				std::stable_sort(order.begin(), order.end(), [&sizes](uint32_t a, uint32_t b) { return sizes[a] > sizes[b]; });
+
+				std::vector<uint32_t> seeds(buckets);
+				std::vector<bool> taken(size);
+				std::vector<uint32_t> positions{};
+				auto maxSeed{ static_cast<uint64_t>(size) * 64 + 1024 };
+				for (auto bucket : order)
+				{
+					if (0 == sizes[bucket]) break;
+
+					//counts[bucket]ƵͰĩβ
+					std::span<const uint32_t> members{ keys.data() + counts[bucket] - sizes[bucket], sizes[bucket] };
+					uint64_t seed{ 0 };
+					for (; seed < maxSeed; ++seed)
+					{
+						positions.clear();
+						for (auto key : members)
+						{
+							auto position{ reduce(mix(hashes[key], static_cast<uint32_t>(seed * 0x9E3779B9u)), size) };
+							if (taken[position] || std::find(positions.begin(), positions.end(), position) != positions.end()) break;
+							positions.push_back(position);
+						}
+						if (positions.size() == members.size()) break;
+					}
+					if (seed == maxSeed) return nullptr;
+
+					seeds[bucket] = static_cast<uint32_t>(seed * 0x9E3779B9u);
+					for (auto position : positions) taken[position] = true;
+				}
+
+				//ͷţСıͷͬһ
+				auto seedsOffset{ (sizeof(PerfectIndex) + alignof(uint32_t) - 1) / alignof(uint32_t) * alignof(uint32_t) };
+				auto slotsOffset{ (seedsOffset + sizeof(uint32_t) * buckets + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot) };
+				auto memory{ static_cast<unsigned char*>(Arena::instance().allocate(slotsOffset + sizeof(Slot) * size, std::max(alignof(PerfectIndex), alignof(Slot)))) };
+
+				auto index{ new (memory) PerfectIndex{} };
+				index->m_size = size;
+				index->m_mask = buckets - 1;
+				index->m_seeds = reinterpret_cast<uint32_t*>(memory + seedsOffset);
+				std::copy(seeds.begin(), seeds.end(), index->m_seeds);
+				index->m_slots = reinterpret_cast<Slot*>(memory + slotsOffset);
+				for (uint32_t i = 0; i < size; ++i) new (&index->m_slots[index->position(hashes[i])]) Slot{ entries[i] };
+				return index;
+			}
+
+		public:
+			/// <summary>
+			/// 
+			/// </summary>
+			/// <param name="name"></param>
+			/// <param name="tag"></param>
+			/// <returns>Ҳʱnullptr</returns>
+			const V* find(std::string_view name, Signature tag) const
+			{
+				const auto& slot{ m_slots[position(NameIndex<V>::hashOf(name, tag))] };
+				return slot.tag == tag && slot.name == name ? &slot.value : nullptr;
+			}
+
+		public:
+			/// <summary>
+			/// С
+			/// СڻУѰַ̽ԤִУȡٶλ۸
+			/// </summary>
+			static constexpr size_t MinSize{ 2048 };
+
+		private:
+			/// <summary>
+			/// ƽÿͰļԽӱԽСԽ
+			/// </summary>
+			static constexpr uint32_t KeysPerBucket{ 4 };
+
+			/// <summary>
+			/// valueӳ䵽[0, range)Գ˷ȡģ
+			/// </summary>
+			static uint32_t reduce(uint32_t value, uint32_t range)
+			{
+				return static_cast<uint32_t>((static_cast<uint64_t>(value) * range) >> 32);
+			}
+
+			/// <summary>
+			/// ͰţhashOf1λ
+			/// </summary>
+			static uint32_t bucketOf(size_t hash, uint32_t mask)
+			{
+				return static_cast<uint32_t>(hash >> 1) & mask;
+			}
+
+			/// <summary>
+			/// Ͱɹϣĵλɸ32λѭλõ
+			/// λʹֻڵλͬҲֻֿܷи32λȫͬŶӳͻ
+			/// </summary>
+			static uint32_t mix(size_t hash, uint32_t seed)
+			{
+				auto high{ static_cast<uint32_t>(static_cast<uint64_t>(hash) >> (sizeof(size_t) > sizeof(uint32_t) ? 32 : 0)) };
+				return std::rotl(high, static_cast<int>(seed & 31)) ^ seed;
+			}
+
+			uint32_t position(size_t hash) const
+			{
+				return reduce(mix(hash, m_seeds[bucketOf(hash, m_mask)]), m_size);
+			}
+
+		private:
+			Slot* m_slots{ nullptr };
+			uint32_t* m_seeds{ nullptr };
+			uint32_t m_size{ 0 };
+			uint32_t m_mask{ 0 };		//ͰһͰΪ2
+		};
+
+		/// <summary>
+		/// ȫַ͵ĳԱ뷽ֻһ
+		/// ÷עд
+		/// </summary>
+		/// <param name="value"></param>
+		/// <returns>ַָ֣ͬ</returns>
+		static std::string_view intern(std::string_view value)
+		{
+			static NameIndex<std::string_view> s_strings{};
+
+			auto keyOf{ [](std::string_view string) { return NameIndex<std::string_view>::Key{ string, 0 }; } };
+			if (auto find{ s_strings.find(value, 0, keyOf) }) return *find;
+
+			auto data{ Arena::instance().allocate<char>(value.size() + 1) };
+			std::copy(value.begin(), value.end(), data);
+			data[value.size()] = '\0';
+
+			std::string_view interned{ data, value.size() };
+			s_strings.insert(interned, 0, interned);
+			return interned;
+		}
+
+		/// <summary>
+		/// Աע˳ţԱLinearLimitʱֽseal()ϣ
+		/// </summary>
+		template<typename T>
+		struct Members
+		{
+		public:
+			static typename NameIndex<const T*>::Key keyOf(const T* info) { return { info->name, 0 }; }
+
+		public:
+			const T* find(std::string_view name) const
+			{
+				if (auto sealed{ this->sealed.load(std::memory_order_acquire) })
+				{
+					auto find{ sealed->find(name, 0) };
+					return find ? *find : nullptr;
+				}
+
+				if (index.built())
+				{
+					auto find{ index.find(name, 0, &keyOf) };
+					return find ? *find : nullptr;
+				}
+
+				auto find{ std::find_if(list.begin(), list.end(), [name](const T& info) { return info.name == name; }) };
+				return find != list.end() ? &*find : nullptr;
+			}
+
+			/// <summary>
+			/// ϣ÷д
+			/// </summary>
+			void seal()
+			{
+				std::vector<typename PerfectIndex<const T*>::Slot> entries{};
+				for (const auto& info : list) entries.push_back({ info.name, 0, &info });
+				sealed.store(PerfectIndex<const T*>::build(entries), std::memory_order_release);
+			}
+
+		public:
+			ArenaArray<T> list{};
+			ArenaVector<std::string_view> names{};
+			NameIndex<const T*> index{};
+			std::atomic<const PerfectIndex<const T*>*> sealed{ nullptr };	//ע³Աʱ
+		};
+
+		/// <summary>
+		/// עԱͬԱֻעһ
+		/// </summary>
+		/// <param name="members">Ա</param>
+		/// <param name="info">ԱϢ滻Ϊַеֺ</param>
+		/// <param name="...args">Ĺ</param>
+		/// <returns></returns>
+		template<typename T, typename... Args>
+		static bool registerMember(Members<T>& members, const T& info, Args... args)
+		{
+			if (members.find(info.name)) return false;
+
+			auto name{ intern(info.name) };
+			const auto& member{ members.list.emplace_back(name, args...) };
+			members.sealed.store(nullptr, std::memory_order_release);
+			members.names.push_back(name);
+
+			if (members.index.built()) members.index.insert(name, 0, &member);
+			else if (members.list.size() > LinearLimit)
+			{
+				for (const auto& val : members.list) members.index.insert(val.name, 0, &val);
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// ע˳ţһַָ飬ͬ
+		/// LinearLimitʱǩָƽseal()ϣ
+		/// </summary>
+		template<typename T>
+		struct Methods
+		{
+		public:
+			static typename NameIndex<const T*>::Key keyOf(const T* info) { return { info->name, info->signature }; }
+
+		public:
+			/// <summary>
+			/// ͬصʼλ
+			/// </summary>
+			/// <param name="name"></param>
+			/// <returns>Ҳʱoverloads.size()</returns>
+			size_t group(std::string_view name) const
+			{
+				if (groups.built())
+				{
+					auto find{ groups.find(name, 0, [this](uint32_t pos) { return NameIndex<uint32_t>::Key{ overloads[pos]->name, 0 }; }) };
+					return find ? *find : overloads.size();
+				}
+				return std::find_if(overloads.begin(), overloads.end(), [name](const T* info) { return info->name == name; }) - overloads.begin();
+			}
+
+			/// <summary>
+			/// ͬصĽλãַУȽָ뼴
+			/// </summary>
+			/// <param name="pos"></param>
+			/// <returns></returns>
+			size_t groupEnd(size_t pos) const
+			{
+				auto name{ overloads[pos]->name.data() };
+				while (pos < overloads.size() && overloads[pos]->name.data() == name) ++pos;
+				return pos;
+			}
+
+			std::span<const T* const> find(std::string_view name) const
+			{
+				if (auto sealed{ sealedGroups.load(std::memory_order_acquire) })
+				{
+					auto find{ sealed->find(name, 0) };
+					return find ? *find : std::span<const T* const>{};
+				}
+
+				auto pos{ group(name) };
+				if (pos == overloads.size()) return {};
+				return overloads.span().subspan(pos, groupEnd(pos) - pos);
+			}
+
+			const T* find(std::string_view name, Signature signature) const
+			{
+				if (auto sealed{ sealedSignatures.load(std::memory_order_acquire) })
+				{
+					auto find{ sealed->find(name, signature) };
+					return find ? *find : nullptr;
+				}
+
+				if (signatures.built())
+				{
+					auto find{ signatures.find(name, signature, &keyOf) };
+					return find ? *find : nullptr;
+				}
+
+				auto candidates{ find(name) };
+				auto match{ std::find_if(candidates.begin(), candidates.end(), [signature](const T* info) { return info->signature == signature; }) };
+				return match != candidates.end() ? *match : nullptr;
+			}
+
+			/// <summary>
+			/// ؽλñ仯
+			/// </summary>
+			void buildGroups()
+			{
+				groups.clear();
+				for (size_t pos = 0; pos < overloads.size(); pos = groupEnd(pos)) groups.insert(overloads[pos]->name, 0, static_cast<uint32_t>(pos));
+			}
+
+			/// <summary>
+			/// 밴ּǩϣ÷д
+			/// </summary>
+			void seal()
+			{
+				std::vector<typename PerfectIndex<std::span<const T* const>>::Slot> entries{};
+				for (size_t pos = 0; pos < overloads.size(); pos = groupEnd(pos)) entries.push_back({ overloads[pos]->name, 0, overloads.span().subspan(pos, groupEnd(pos) - pos) });
+				sealedGroups.store(PerfectIndex<std::span<const T* const>>::build(entries), std::memory_order_release);
+
+				std::vector<typename PerfectIndex<const T*>::Slot> methods{};
+				for (const auto& info : list) methods.push_back({ info.name, info.signature, &info });
+				sealedSignatures.store(PerfectIndex<const T*>::build(methods), std::memory_order_release);
+			}
+
+		public:
+			ArenaArray<T> list{};
+			ArenaVector<const T*> overloads{};
+			ArenaVector<std::string_view> names{};
+			NameIndex<uint32_t> groups{};
+			NameIndex<const T*> signatures{};
+			std::atomic<const PerfectIndex<std::span<const T* const>>*> sealedGroups{ nullptr };		//ע·ʱ
+			std::atomic<const PerfectIndex<const T*>*> sealedSignatures{ nullptr };
+		};
+
+		/// <summary>
+		/// ע᷽ͬͬǩķֻעһ
+		/// </summary>
+		/// <param name="methods"></param>
+		/// <param name="info">Ϣ</param>
+		/// <param name="owner"></param>
+		/// <returns></returns>
+		template<typename T>
+		static bool registerMethod(Methods<T>& methods, const T& info, const RTTRInfo* owner)
+		{
+			if (methods.find(info.name, info.signature)) return false;
+
+			auto name{ intern(info.name) };
+			const auto& method{ methods.list.emplace_back(info, name, owner) };
+			methods.sealedGroups.store(nullptr, std::memory_order_release);
+			methods.sealedSignatures.store(nullptr, std::memory_order_release);
+
+			auto pos{ methods.group(name) };
+			if (pos == methods.overloads.size())
+			{
+				methods.overloads.push_back(&method);
+				methods.names.push_back(name);
+				if (methods.groups.built()) methods.groups.insert(name, 0, static_cast<uint32_t>(pos));
+				else if (methods.names.size() > LinearLimit) methods.buildGroups();
+			}
+			else
+			{
+				//֮ͬķ
+				methods.overloads.insert(methods.groupEnd(pos), &method);
+				if (methods.groups.built()) methods.buildGroups();
+			}
+
+			if (methods.signatures.built()) methods.signatures.insert(name, info.signature, &method);
+			else if (methods.list.size() > LinearLimit)
+			{
+				for (const auto& val : methods.list) methods.signatures.insert(val.name, val.signature, &val);
+			}
+			return true;
+		}
+
+	public:
+		/// <summary>
+		/// չļ̳бȼָԼʱÿȵĸ汾
+		/// ޸ģڴвͷţֻĳȵǼ¸ʱŹؽעԱ򷽷Ӱ
+		/// </summary>
+		struct Hierarchy
 		{
 		public:
-			explicit AddressEqual(const void* address) : address(address) {}
+			struct Slot
+			{
+			public:
+				TypeId id{ 0 };
+				const Ancestor* ancestor{ nullptr };		//ΪnullptrʱΪղ
+			};
 
 		public:
+			/// <summary>
+			/// Ϣչ̳б÷жȵע鶼ִ
+			/// </summary>
+			/// <param name="info"></param>
+			/// <returns></returns>
+			static const Hierarchy* build(const RTTRInfo& info)
+			{
+				//ȣǰͬһྭͬ·ҵͬʱ(μ̳)δ֪
+				std::vector<Ancestor> ancestors{ { &info, 0 } };
+				for (size_t i = 0; i < ancestors.size(); ++i)
+				{
+					auto [current, offset] { ancestors[i] };
+					for (const auto& superclass : current->impl().superclass)
+					{
+						auto adjusted{ offset == Superclass::UnknownOffset || superclass.offset == Superclass::UnknownOffset ? Superclass::UnknownOffset : offset + superclass.offset };
+						auto find{ std::find_if(ancestors.begin(), ancestors.end(), [&superclass](const Ancestor& val) { return val.info == superclass.info; }) };
+						if (find == ancestors.end()) ancestors.push_back({ superclass.info, adjusted });
+						else if (find->offset != adjusted) find->offset = Superclass::UnknownOffset;
+					}
+				}
+
+				auto hierarchy{ new (Arena::instance().allocate(sizeof(Hierarchy), alignof(Hierarchy))) Hierarchy{} };
+
+				auto list{ Arena::instance().allocate<Ancestor>(ancestors.size()) };
+				std::uninitialized_copy(ancestors.begin(), ancestors.end(), list);
+				hierarchy->ancestors = { list, ancestors.size() };
+
+				auto versions{ Arena::instance().allocate<uint32_t>(ancestors.size()) };
+				for (size_t i = 0; i < ancestors.size(); ++i) versions[i] = ancestors[i].info->impl().superclassVersion.load(std::memory_order_acquire);
+				hierarchy->versions = versions;
+
+				size_t capacity{ 4 };
+				while (capacity < ancestors.size() * 2) capacity *= 2;
+				hierarchy->slots = Arena::instance().allocate<Slot>(capacity);
+				std::uninitialized_value_construct_n(hierarchy->slots, capacity);
+				hierarchy->mask = capacity - 1;
+				for (const auto& ancestor : hierarchy->ancestors)
+				{
+					auto id{ ancestor.info->id() };
+					auto i{ id & hierarchy->mask };
+					while (hierarchy->slots[i].ancestor) i = (i + 1) & hierarchy->mask;
+					hierarchy->slots[i] = { id, &ancestor };
+				}
+				return hierarchy;
+			}
+
+		public:
+			const Ancestor* find(TypeId id) const
+			{
+				for (auto i{ id & mask }; ; i = (i + 1) & mask)
+				{
+					const auto& slot{ slots[i] };
+					if (nullptr == slot.ancestor || slot.id == id) return slot.ancestor;
+				}
+			}
+
+			/// <summary>
+			/// ȵĸ汾빹ʱͬ
+			/// </summary>
+			/// <returns></returns>
+			bool current() const
+			{
+				for (size_t i = 0; i < ancestors.size(); ++i)
+					if (ancestors[i].info->impl().superclassVersion.load(std::memory_order_acquire) != versions[i]) return false;
+				return true;
+			}
+
+			/// <summary>
+			/// ɽԶ֣ҵغͬ÷ж
+			/// </summary>
+			/// <param name="find">һıвңδҵʱؿֵ</param>
+			/// <returns></returns>
+			template<typename T, typename Find>
+			Inherited<T> inherited(Find find) const
+			{
+				for (const auto& ancestor : ancestors)
+				{
+					T found{ find(ancestor.info->impl()) };
+					if (!empty(found)) return { found, ancestor.info, ancestor.offset };
+				}
+				return {};
+			}
+
+		private:
+			template<typename T>
+			static bool empty(const T* val) { return nullptr == val; }
+
 			template<typename T>
-			bool operator ()(const T& value) { return value.address == address; }
+			static bool empty(std::span<const T* const> val) { return val.empty(); }
+
+		public:
+			std::span<const Ancestor> ancestors{};
+			const uint32_t* versions{ nullptr };			//ancestorsһһӦ
+			Slot* slots{ nullptr };
+			size_t mask{ 0 };
+		};
+
+		/// <summary>
+		/// ȡǰļ̳бһȵǼ¸ʱؽ
+		/// </summary>
+		/// <param name="info">Ϣ</param>
+		/// <returns></returns>
+		const Hierarchy& hierarchyOf(const RTTRInfo& info)
+		{
+			auto cached{ hierarchy.load(std::memory_order_acquire) };
+			if (cached && cached->current()) return *cached;
+
+			materializeAncestors(info);
+
+			//ؽʱԷ󷢲ĸȷģɱͷţڶ̲߳Ӱ
+			auto lock{ readLock() };
+			auto built{ Hierarchy::build(info) };
+			hierarchy.store(built, std::memory_order_release);
+			return *built;
+		}
+
+		/// <summary>
+		/// ִͼȵӳע飬עеǼǵĸ֮չ
+		/// ܳעִʱҪд
+		/// </summary>
+		/// <param name="info"></param>
+		static void materializeAncestors(const RTTRInfo& info)
+		{
+			std::vector<const RTTRInfo*> pending{ &info };
+			for (size_t i = 0; i < pending.size(); ++i)
+			{
+				pending[i]->materialize();
+
+				auto lock{ readLock() };
+				for (const auto& superclass : pending[i]->impl().superclass)
+					if (std::find(pending.begin(), pending.end(), superclass.info) == pending.end()) pending.push_back(superclass.info);
+			}
+		}
+
+	public:
+		/// <summary>
+		/// IDΪͱѰַ̽
+		/// ʱһֻգʱ
+		/// </summary>
+		class TypeIndex
+		{
+		public:
+			RTTRInfo* find(TypeId id) const
+			{
+				for (auto i{ id & m_mask }; ; i = (i + 1) & m_mask)
+				{
+					const auto& [slotId, info] { m_slots[i] };
+					if (nullptr == info || slotId == id) return info;
+				}
+			}
+
+			/// <summary>
+			/// Ϣ
+			/// </summary>
+			/// <param name="info"></param>
+			/// <returns>ѴͬIDʱеϢ</returns>
+			RTTRInfo* insert(RTTRInfo* info)
+			{
+				if (auto find{ this->find(info->id()) }) return find;
+
+				if ((m_size + 1) * 2 > m_slots.size())
+				{
+					std::vector<std::pair<TypeId, RTTRInfo*>> slots(m_slots.size() * 2);
+					std::swap(slots, m_slots);
+					m_mask = m_slots.size() - 1;
+					for (const auto& [id, slot] : slots)
+						if (slot) place(id, slot);
+				}
+
+				place(info->id(), info);
+				++m_size;
+				return info;
+			}
+
+			/// <summary>
+			/// Ϣ˳򲻶
+			/// </summary>
+			/// <param name="func">func(info)</param>
+			template<typename F>
+			void forEach(F func) const
+			{
+				for (const auto& [id, info] : m_slots)
+					if (info) func(info);
+			}
 
 		private:
-			const void* address;
+			void place(TypeId id, RTTRInfo* info)
+			{
+				auto i{ id & m_mask };
+				while (m_slots[i].second) i = (i + 1) & m_mask;
+				m_slots[i] = { id, info };
+			}
+
+		private:
+			size_t m_mask{ 15 };
+			size_t m_size{ 0 };
+			std::vector<std::pair<TypeId, RTTRInfo*>> m_slots{ 16 };
 		};
 
 	public:
-		static inline std::unordered_map<std::string, RTTRInfo*> s_infos{};
+		/// <summary>
+		/// ֻͱδʱΪnullptr
+		/// </summary>
+		static inline constinit std::atomic<const TypeIndex*> s_frozen{ nullptr };
+
+		/// <summary>
+		/// seal()ϣעʱ
+		/// </summary>
+		static inline constinit std::atomic<const PerfectIndex<RTTRInfo*>*> s_sealed{ nullptr };
+
+		/// <summary>
+		/// Ƿseal()֮ûע
+		/// </summary>
+		static inline constinit std::atomic<bool> s_isSealed{ false };
+
+		/// <summary>
+		/// ͨöѷصδʱΪnullptr
+		/// </summary>
+		static inline constinit std::atomic<AllocationHook> s_allocationHook{ nullptr };
+
+		/// <summary>
+		/// ע׶αȫͱϢ
+		/// </summary>
+		/// <returns></returns>
+		static std::shared_mutex& mutex()
+		{
+			static std::shared_mutex s_mutex{};
+			return s_mutex;
+		}
+
+		/// <summary>
+		/// ټ
+		/// </summary>
+		/// <returns></returns>
+		static std::shared_lock<std::shared_mutex> readLock()
+		{
+			if (s_frozen.load(std::memory_order_acquire)) return {};
+			return std::shared_lock{ mutex() };
+		}
+
+		/// <summary>
+		/// д󷵻δе÷ݴ˾ܾע
+		/// </summary>
+		/// <returns></returns>
+		static std::unique_lock<std::shared_mutex> writeLock()
+		{
+			std::unique_lock lock{ mutex() };
+			if (s_frozen.load(std::memory_order_relaxed)) lock.unlock();
+			return lock;
+		}
+
+		/// <summary>
+		/// ޸targetд
+		/// עֻ޸ִעͣ޸ʱܾ޸ҪȱͱѯЧڼѯtarget©
+		/// </summary>
+		/// <param name="target">޸ĵ</param>
+		/// <returns></returns>
+		static std::unique_lock<std::shared_mutex> writeLock(const RTTRInfo& target)
+		{
+			if (t_materializing && t_materializing != &target)
+			{
+				assert(false && "A registration block may only register into its own type, call RTTR::Registration<U>::once() to register U");
+				return {};
+			}
+			return writeLock();
+		}
+
+		/// <summary>
+		/// ִӳע룬עвѯʱǶִ
+		/// ˳עעʱִע
+		/// </summary>
+		/// <returns></returns>
+		static std::recursive_mutex& materializeMutex()
+		{
+			static std::recursive_mutex s_mutex{};
+			return s_mutex;
+		}
+
+		/// <summary>
+		/// ǰִ߳еעͣûִʱΪnullptr
+		/// </summary>
+		static inline thread_local const RTTRInfo* t_materializing{ nullptr };
+
+	public:
+		/// <summary>
+		/// ȫͱIDΪ
+		/// úھ̬뵥Ԫо̬עĳʼ˳
+		/// </summary>
+		/// <returns></returns>
+		static TypeIndex& infos()
+		{
+			static TypeIndex s_infos{};
+			return s_infos;
+		}
 
 	public:
 		RTTRInfoImpl() = default;
 
 	public:
-		std::list<Superclass> superclass;										//
+		/// <summary>
+		/// ΪгԱ뷽ϣ÷д
+		/// </summary>
+		void seal()
+		{
+			staticMembers.seal();
+			normalMembers.seal();
+			staticMethods.seal();
+			normalMethods.seal();
+			constMethods.seal();
+		}
+
+		/// <summary>
+		/// Ϊ͵ֱϣ
+		/// ʱѯúŷڲѯ߳̿Ǿ
+		/// </summary>
+		static void sealAll()
+		{
+			std::unique_lock lock{ mutex() };
+			std::vector<PerfectIndex<RTTRInfo*>::Slot> entries{};
+			infos().forEach([&entries](RTTRInfo* info)
+				{
+					info->impl().seal();
+					entries.push_back({ info->name(), 0, info });
+				});
+			s_sealed.store(PerfectIndex<RTTRInfo*>::build(entries), std::memory_order_release);
+			s_isSealed.store(true, std::memory_order_release);
+		}
+
+	public:
+		ArenaArray<Superclass> superclass{};									//
+		ArenaVector<std::string_view> superclassNames{};						//
+		std::atomic<uint32_t> superclassVersion{ 0 };						//Ǽ¸ʱչļ̳бݴжǷ
+
+		Members<StaticMemberInfo> staticMembers{};								//̬Ա
+		Members<NormalMemberInfo> normalMembers{};								//ͨԱ
 
-		std::unordered_map<std::string, StaticMemberInfo> staticMembers{};		//̬Ա
-		std::unordered_map<std::string, NormalMemberInfo> normalMembers{};		//ͨԱ
+		Methods<StaticMethodInfo> staticMethods{};								//̬
+		Methods<NormalMethodInfo> normalMethods{};								//ͨ
+		Methods<ConstMethodInfo> constMethods{};								//const
 
-		std::unordered_multimap<std::string, StaticMethodInfo> staticMethods{};	//̬
-		std::unordered_multimap<std::string, NormalMethodInfo> normalMethods{};	//ͨ
-		std::unordered_multimap<std::string, ConstMethodInfo> constMethods{};	//const
+		std::atomic<const Hierarchy*> hierarchy{ nullptr };					//չļ̳б
+
+		ArenaArray<ConstructorInfo> constructors{};							//캯
+		std::atomic<Pool*> pool{ nullptr };									//أڴв
+		std::atomic<bool> allocated{ false };								//ǷѴͨöѷ
+
+		int dirtyOffset{ -1 };												//λƫƣעͨԱ֮ǰ
+		uint32_t dirtyCapacity{ 0 };										//λλ
 	};
+
+	static_assert(std::is_trivially_destructible_v<RTTRInfoImpl>, "RTTRInfoImpl lives in the arena and is never destroyed");
 }
 
-RTTR::RTTRInfo* RTTR::RTTRInfo::info(const std::string& name)
+RTTR::RTTRInfo* RTTR::RTTRInfo::info(std::string_view name)
 {
-	auto find{ RTTRInfoImpl::s_infos.find(name) };
-	return find != RTTRInfoImpl::s_infos.end() ? find->second : nullptr;
+	if (auto sealed{ RTTRInfoImpl::s_sealed.load(std::memory_order_acquire) })
+	{
+		auto find{ sealed->find(name, 0) };
+		return find ? *find : nullptr;
+	}
+
+	auto info{ RTTRInfo::info(typeId(name)) };
+	return info && info->name() == name ? info : nullptr;
+}
+
+RTTR::RTTRInfo* RTTR::RTTRInfo::info(TypeId id)
+{
+	if (auto frozen{ RTTRInfoImpl::s_frozen.load(std::memory_order_acquire) }) return frozen->find(id);
+
+	std::shared_lock lock{ RTTRInfoImpl::mutex() };
+	return RTTRInfoImpl::infos().find(id);
 }
 
 bool RTTR::RTTRInfo::registerRTTRInfo(RTTRInfo* info)
 {
 	assert(info != nullptr);
 
-	if (nullptr == RTTRInfo::info(info->name()))
+	auto lock{ RTTRInfoImpl::writeLock() };
+	if (!lock) return false;
+
+	auto registered{ RTTRInfoImpl::infos().insert(info) };
+	assert(registered == info || registered->name() == info->name());
+	if (registered == info)
 	{
-		RTTRInfoImpl::s_infos.insert({ info->name(), info });
-		return true;
+		RTTRInfoImpl::s_sealed.store(nullptr, std::memory_order_release);
+		RTTRInfoImpl::s_isSealed.store(false, std::memory_order_release);
 	}
-	return false;
+	return registered == info;
 }
 
-RTTR::RTTRInfo::RTTRInfo() :
-	m_impl(new RTTRInfoImpl{})
+RTTR::RTTRInfo::RTTRInfo(TypeId id, std::string_view name) :
+	m_id(id), m_name(name)
 {
+	assert(!name.empty() && id == typeId(name));
 }
 
 RTTR::RTTRInfo::~RTTRInfo() = default;
 
-void RTTR::RTTRInfo::registerSuperclass(const Superclass& info)
+RTTR::RTTRInfoImpl& RTTR::RTTRInfo::allocateImpl() const
 {
-	if (false == superclass(info.info->name()).has_value()) m_impl->superclass.push_back(info);
+	//ʱֻһݣڴ
+	auto allocated{ new (Arena::instance().allocate(sizeof(RTTRInfoImpl), alignof(RTTRInfoImpl))) RTTRInfoImpl{} };
+	RTTRInfoImpl* expected{ nullptr };
+	if (m_impl.compare_exchange_strong(expected, allocated, std::memory_order_acq_rel)) return *allocated;
+	return *expected;
 }
 
-std::list<std::string> RTTR::RTTRInfo::superclassNames() const
+struct RTTR::RTTRInfo::PlanChunk
+{
+public:
+	std::atomic<const void*> plans[PlanSlots]{};
+	std::atomic<PlanChunk*> next{ nullptr };
+};
+
+std::atomic<const void*>& RTTR::RTTRInfo::overflowPlan(size_t slot) const
 {
-	std::list<std::string> names;
-	for (const auto& val : m_impl->superclass) names.push_back(val.info->name());
-	return names;
+	auto link{ &m_morePlans };
+	for (;;)
+	{
+		//ʱֻһݣڴ
+		auto chunk{ link->load(std::memory_order_acquire) };
+		if (nullptr == chunk)
+		{
+			auto allocated{ new (Arena::instance().allocate(sizeof(PlanChunk), alignof(PlanChunk))) PlanChunk{} };
+			chunk = link->compare_exchange_strong(chunk, allocated, std::memory_order_acq_rel) ? allocated : chunk;
+		}
+
+		if (slot < PlanSlots) return chunk->plans[slot];
+		slot -= PlanSlots;
+		link = &chunk->next;
+	}
 }
 
-std::optional<RTTR::Superclass> RTTR::RTTRInfo::superclass(const std::string& name) const
+bool RTTR::RTTRInfo::registerLazy(Registrar registrar)
 {
-	auto find{ std::find_if(m_impl->superclass.begin(), m_impl->superclass.end(), [&name](const Superclass& val) { return val.info->name() == name; }) };
-	return find != m_impl->superclass.end() ? std::optional{ *find } : std::nullopt;
+	assert(registrar != nullptr);
+
+	//freeze()⣺ǰǼǵע鶼ڶǰִ
+	std::shared_lock lock{ RTTRInfoImpl::mutex() };
+	if (frozen()) return false;
+
+	Registrar expected{ nullptr };
+	return m_registrar.compare_exchange_strong(expected, registrar, std::memory_order_acq_rel);
 }
 
-bool RTTR::RTTRInfo::registerStaticMember(const StaticMemberInfo& info)
+void RTTR::RTTRInfo::runRegistrar() const
+{
+	std::lock_guard lock{ RTTRInfoImpl::materializeMutex() };
+	auto registrar{ m_registrar.load(std::memory_order_relaxed) };
+	if (nullptr == registrar || m_materializing) return;
+
+	//עвѯʱ룻עвѯʱǶִУָ
+	m_materializing = true;
+	try
+	{
+		const_cast<RTTRInfo*>(this)->registerWith(registrar);
+	}
+	catch (...)
+	{
+		m_materializing = false;
+		throw;
+	}
+	m_materializing = false;
+	m_registrar.store(nullptr, std::memory_order_release);
+}
+
+void RTTR::RTTRInfo::registerWith(Registrar registrar)
 {
-	if (false == staticMember(info.name).has_value())
+	assert(registrar != nullptr);
+
+	auto outer{ std::exchange(RTTRInfoImpl::t_materializing, this) };
+	try
 	{
-		m_impl->staticMembers.insert({ info.name, info });
-		return true;
+		registrar(*this);
 	}
-	return false;
+	catch (...)
+	{
+		RTTRInfoImpl::t_materializing = outer;
+		throw;
+	}
+	RTTRInfoImpl::t_materializing = outer;
 }
 
-std::list<std::string> RTTR::RTTRInfo::staticMemberNames() const
+bool RTTR::RTTRInfo::equals(const void* lhs, const void* rhs) const
 {
-	std::list<std::string> names;
-	for (const auto& [name, info] : m_impl->staticMembers) names.push_back(name);
-	return names;
+	return equalMembers(*this, lhs, rhs);
 }
 
-std::optional<RTTR::StaticMemberInfo> RTTR::RTTRInfo::staticMember(const std::string& name) const
+size_t RTTR::RTTRInfo::hash(const void* o) const
 {
-	auto find{ m_impl->staticMembers.find(name) };
-	return find != m_impl->staticMembers.end() ? std::optional{ find->second } : std::nullopt;
+	return hashMembers(*this, o);
 }
 
-bool RTTR::RTTRInfo::registerNormalMember(const NormalMemberInfo& info)
+void RTTR::RTTRInfo::serialize(const void* o, BinaryWriter& writer) const
 {
-	if (false == normalMember(info.name).has_value())
+	writeMembers(*this, o, writer);
+}
+
+bool RTTR::RTTRInfo::deserialize(void* o, BinaryReader& reader) const
+{
+	return readMembers(*this, o, reader);
+}
+
+void RTTR::RTTRInfo::writeJson(const void* o, JsonWriter& writer) const
+{
+	writeJsonMembers(*this, o, writer);
+}
+
+bool RTTR::RTTRInfo::readJson(void* o, JsonReader& reader) const
+{
+	return readJsonMembers(*this, o, reader);
+}
+
+void RTTR::RTTRInfo::registerSuperclass(const Superclass& info)
+{
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return;
+
+	auto id{ info.info->id() };
+	if (std::none_of(impl().superclass.begin(), impl().superclass.end(), [id](const Superclass& val) { return val.info->id() == id; }))
 	{
-		m_impl->normalMembers.insert({ info.name, info });
-		return true;
+		impl().superclass.emplace_back(info);
+		impl().superclassNames.push_back(info.info->name());
+		impl().superclassVersion.fetch_add(1, std::memory_order_release);
 	}
-	return false;
 }
 
-std::list<std::string> RTTR::RTTRInfo::normalMemberNames() const
+std::span<const std::string_view> RTTR::RTTRInfo::superclassNames() const
 {
-	std::list<std::string> names;
-	for (const auto& [name, info] : m_impl->normalMembers) names.push_back(name);
-	return names;
+	materialize();
+	return impl().superclassNames.span();
 }
 
-std::optional<RTTR::NormalMemberInfo> RTTR::RTTRInfo::normalMember(const std::string& name) const
+const RTTR::ArenaArray<RTTR::Superclass>& RTTR::RTTRInfo::superclasses() const
 {
-	auto find{ m_impl->normalMembers.find(name) };
-	return find != m_impl->normalMembers.end() ? std::optional{ find->second } : std::nullopt;
+	materialize();
+	return impl().superclass;
 }
 
-bool RTTR::RTTRInfo::registerStaticMethod(const StaticMethodInfo& info)
+const RTTR::Superclass* RTTR::RTTRInfo::superclass(std::string_view name) const
+{
+	return superclass(typeId(name));
+}
+
+const RTTR::Superclass* RTTR::RTTRInfo::superclass(TypeId id) const
 {
-	if (auto methods{ staticMethod(info.name) }; std::find_if(methods.begin(), methods.end(), RTTRInfoImpl::AddressEqual{ info.address }) == methods.end())
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	auto find{ std::find_if(impl().superclass.begin(), impl().superclass.end(), [id](const Superclass& val) { return val.info->id() == id; }) };
+	return find != impl().superclass.end() ? &*find : nullptr;
+}
+
+bool RTTR::RTTRInfo::registerConstructor(const ConstructorInfo& info)
+{
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	auto signature{ info.signature };
+	if (std::any_of(impl().constructors.begin(), impl().constructors.end(), [signature](const ConstructorInfo& val) { return val.signature == signature; })) return false;
+
+	impl().constructors.emplace_back(info);
+	return true;
+}
+
+const RTTR::ArenaArray<RTTR::ConstructorInfo>& RTTR::RTTRInfo::constructors() const
+{
+	materialize();
+	return impl().constructors;
+}
+
+const RTTR::ConstructorInfo* RTTR::RTTRInfo::constructor(Signature signature) const
+{
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	auto find{ std::find_if(impl().constructors.begin(), impl().constructors.end(), [signature](const ConstructorInfo& val) { return val.signature == signature; }) };
+	return find != impl().constructors.end() ? &*find : nullptr;
+}
+
+bool RTTR::RTTRInfo::registerPool(size_t objectsPerChunk)
+{
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	//жͨöѷʱлЩᱻ黹
+	if (impl().pool.load(std::memory_order_relaxed) || impl().allocated.load(std::memory_order_relaxed)) return false;
+
+	auto pool{ new (Arena::instance().allocate(sizeof(Pool), alignof(Pool))) Pool{ std::max<size_t>(size(), 1), alignment(), objectsPerChunk } };
+	impl().pool.store(pool, std::memory_order_release);
+	return true;
+}
+
+const RTTR::Pool* RTTR::RTTRInfo::pool() const
+{
+	materialize();
+	return impl().pool.load(std::memory_order_acquire);
+}
+
+void* RTTR::RTTRInfo::allocate() const
+{
+	materialize();
+	if (auto pool{ impl().pool.load(std::memory_order_acquire) }) return pool->allocate();
+
+	if (!impl().allocated.load(std::memory_order_relaxed)) impl().allocated.store(true, std::memory_order_relaxed);
+	auto bytes{ std::max<size_t>(size(), 1) };
+	if (auto hook{ RTTRInfoImpl::s_allocationHook.load(std::memory_order_relaxed) }) hook(*this, bytes);
+	return ::operator new(bytes, std::align_val_t{ alignment() });
+}
+
+void RTTR::RTTRInfo::deallocate(void* memory) const
+{
+	if (auto pool{ impl().pool.load(std::memory_order_acquire) }) pool->deallocate(memory);
+	else ::operator delete(memory, std::align_val_t{ alignment() });
+}
+
+void* RTTR::RTTRInfo::create(const ConstructorInfo& constructor, void** args) const
+{
+	assert(std::any_of(impl().constructors.begin(), impl().constructors.end(), [&constructor](const ConstructorInfo& val) { return &val == &constructor; }));
+
+	auto memory{ allocate() };
+	try
 	{
-		m_impl->staticMethods.insert({ info.name, info });
-		return true;
+		constructor.call(memory, args);
 	}
-	return false;
+	catch (...)
+	{
+		deallocate(memory);
+		throw;
+	}
+	return memory;
+}
+
+void RTTR::RTTRInfo::destroy(void* o) const
+{
+	if (nullptr == o) return;
+
+	destruct(o);
+	deallocate(o);
+}
+
+std::span<const RTTR::Ancestor> RTTR::RTTRInfo::ancestors() const
+{
+	return impl().hierarchyOf(*this).ancestors;
+}
+
+const RTTR::Ancestor* RTTR::RTTRInfo::ancestor(TypeId id) const
+{
+	return impl().hierarchyOf(*this).find(id);
+}
+
+void* RTTR::RTTRInfo::upcast(void* o, const RTTRInfo* base) const
+{
+	auto ancestor{ base ? this->ancestor(base->id()) : nullptr };
+	if (nullptr == o || nullptr == ancestor || ancestor->offset == Superclass::UnknownOffset) return nullptr;
+	return static_cast<unsigned char*>(o) + ancestor->offset;
+}
+
+void* RTTR::RTTRInfo::downcast(void* o, const RTTRInfo* derived) const
+{
+	auto ancestor{ derived ? derived->ancestor(m_id) : nullptr };
+	if (nullptr == o || nullptr == ancestor || ancestor->offset == Superclass::UnknownOffset) return nullptr;
+	return static_cast<unsigned char*>(o) - ancestor->offset;
+}
+
+RTTR::Inherited<const RTTR::StaticMemberInfo*> RTTR::RTTRInfo::inheritedStaticMember(std::string_view name) const
+{
+	const auto& hierarchy{ impl().hierarchyOf(*this) };
+	auto lock{ RTTRInfoImpl::readLock() };
+	return hierarchy.inherited<const StaticMemberInfo*>([name](const RTTRInfoImpl& ancestor) { return ancestor.staticMembers.find(name); });
+}
+
+RTTR::Inherited<const RTTR::NormalMemberInfo*> RTTR::RTTRInfo::inheritedNormalMember(std::string_view name) const
+{
+	const auto& hierarchy{ impl().hierarchyOf(*this) };
+	auto lock{ RTTRInfoImpl::readLock() };
+	return hierarchy.inherited<const NormalMemberInfo*>([name](const RTTRInfoImpl& ancestor) { return ancestor.normalMembers.find(name); });
+}
+
+RTTR::Inherited<std::span<const RTTR::StaticMethodInfo* const>> RTTR::RTTRInfo::inheritedStaticMethod(std::string_view name) const
+{
+	const auto& hierarchy{ impl().hierarchyOf(*this) };
+	auto lock{ RTTRInfoImpl::readLock() };
+	return hierarchy.inherited<std::span<const StaticMethodInfo* const>>([name](const RTTRInfoImpl& ancestor) { return ancestor.staticMethods.find(name); });
+}
+
+RTTR::Inherited<std::span<const RTTR::NormalMethodInfo* const>> RTTR::RTTRInfo::inheritedNormalMethod(std::string_view name) const
+{
+	const auto& hierarchy{ impl().hierarchyOf(*this) };
+	auto lock{ RTTRInfoImpl::readLock() };
+	return hierarchy.inherited<std::span<const NormalMethodInfo* const>>([name](const RTTRInfoImpl& ancestor) { return ancestor.normalMethods.find(name); });
+}
+
+RTTR::Inherited<std::span<const RTTR::ConstMethodInfo* const>> RTTR::RTTRInfo::inheritedConstMethod(std::string_view name) const
+{
+	const auto& hierarchy{ impl().hierarchyOf(*this) };
+	auto lock{ RTTRInfoImpl::readLock() };
+	return hierarchy.inherited<std::span<const ConstMethodInfo* const>>([name](const RTTRInfoImpl& ancestor) { return ancestor.constMethods.find(name); });
+}
+
+bool RTTR::RTTRInfo::registerStaticMember(const StaticMemberInfo& info)
+{
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	return RTTRInfoImpl::registerMember(impl().staticMembers, info, info.interview, info.info, info.address);
+}
+
+std::span<const std::string_view> RTTR::RTTRInfo::staticMemberNames() const
+{
+	materialize();
+	return impl().staticMembers.names.span();
 }
 
-std::unordered_set<std::string> RTTR::RTTRInfo::staticMethodNames() const
+const RTTR::ArenaArray<RTTR::StaticMemberInfo>& RTTR::RTTRInfo::staticMembers() const
 {
-	std::unordered_set<std::string> names;
-	for (const auto& [name, info] : m_impl->staticMethods) names.insert(name);
-	return names;
+	materialize();
+	return impl().staticMembers.list;
 }
 
-std::list<RTTR::StaticMethodInfo> RTTR::RTTRInfo::staticMethod(const std::string& name) const
+const RTTR::StaticMemberInfo* RTTR::RTTRInfo::staticMember(std::string_view name) const
 {
-	std::list<RTTR::StaticMethodInfo> methods;
-	auto pair{ m_impl->staticMethods.equal_range(name) };
-	while (pair.first != pair.second) methods.push_back(pair.first++->second);
-	return methods;
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().staticMembers.find(name);
+}
+
+bool RTTR::RTTRInfo::registerDirtyBits(int offset, size_t capacity)
+{
+	assert(offset >= 0 && capacity > 0);
+
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	//עĳԱûм¼λƫ
+	if (impl().dirtyOffset >= 0 || !impl().normalMembers.list.empty()) return false;
+
+	impl().dirtyOffset = offset;
+	impl().dirtyCapacity = static_cast<uint32_t>(std::min<size_t>(capacity, UINT32_MAX));
+	return true;
+}
+
+std::span<uint64_t> RTTR::RTTRInfo::dirtyBits(void* o) const
+{
+	assert(o != nullptr);
+
+	materialize();
+	if (impl().dirtyOffset < 0) return {};
+	return { reinterpret_cast<uint64_t*>(static_cast<unsigned char*>(o) + impl().dirtyOffset), (impl().dirtyCapacity + 63) / 64 };
+}
+
+std::span<const uint64_t> RTTR::RTTRInfo::dirtyBits(const void* o) const
+{
+	return dirtyBits(const_cast<void*>(o));
+}
+
+bool RTTR::RTTRInfo::registerNormalMember(const NormalMemberInfo& info)
+{
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	auto ordinal{ static_cast<uint32_t>(impl().normalMembers.list.size()) };
+	assert(ordinal < impl().dirtyCapacity || impl().dirtyOffset < 0);
+	auto dirtyOffset{ ordinal < impl().dirtyCapacity ? impl().dirtyOffset : -1 };
+	return RTTRInfoImpl::registerMember(impl().normalMembers, info, info.interview, info.info, info.offset, dirtyOffset, ordinal);
+}
+
+std::span<const std::string_view> RTTR::RTTRInfo::normalMemberNames() const
+{
+	materialize();
+	return impl().normalMembers.names.span();
+}
+
+const RTTR::ArenaArray<RTTR::NormalMemberInfo>& RTTR::RTTRInfo::normalMembers() const
+{
+	materialize();
+	return impl().normalMembers.list;
+}
+
+const RTTR::NormalMemberInfo* RTTR::RTTRInfo::normalMember(std::string_view name) const
+{
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().normalMembers.find(name);
+}
+
+bool RTTR::RTTRInfo::registerStaticMethod(const StaticMethodInfo& info)
+{
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	return RTTRInfoImpl::registerMethod(impl().staticMethods, info, this);
+}
+
+std::span<const std::string_view> RTTR::RTTRInfo::staticMethodNames() const
+{
+	materialize();
+	return impl().staticMethods.names.span();
+}
+
+const RTTR::ArenaArray<RTTR::StaticMethodInfo>& RTTR::RTTRInfo::staticMethods() const
+{
+	materialize();
+	return impl().staticMethods.list;
+}
+
+std::span<const RTTR::StaticMethodInfo* const> RTTR::RTTRInfo::staticMethod(std::string_view name) const
+{
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().staticMethods.find(name);
+}
+
+const RTTR::StaticMethodInfo* RTTR::RTTRInfo::staticMethod(std::string_view name, Signature signature) const
+{
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().staticMethods.find(name, signature);
 }
 
 bool RTTR::RTTRInfo::registerNormalMethod(const NormalMethodInfo& info)
 {
-	if (auto methods{ normalMethod(info.name) }; std::find_if(methods.begin(), methods.end(), RTTRInfoImpl::AddressEqual{ info.address }) == methods.end())
-	{
-		m_impl->normalMethods.insert({ info.name, info });
-		return true;
-	}
-	return false;
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	return RTTRInfoImpl::registerMethod(impl().normalMethods, info, this);
+}
+
+std::span<const std::string_view> RTTR::RTTRInfo::normalMethodNames() const
+{
+	materialize();
+	return impl().normalMethods.names.span();
 }
 
-std::unordered_set<std::string> RTTR::RTTRInfo::normalMethodNames() const
+const RTTR::ArenaArray<RTTR::NormalMethodInfo>& RTTR::RTTRInfo::normalMethods() const
 {
-	std::unordered_set<std::string> names{};
-	for (const auto& [name, info] : m_impl->normalMethods) names.insert(name);
-	return names;
+	materialize();
+	return impl().normalMethods.list;
 }
 
-std::list<RTTR::NormalMethodInfo> RTTR::RTTRInfo::normalMethod(const std::string& name) const
+std::span<const RTTR::NormalMethodInfo* const> RTTR::RTTRInfo::normalMethod(std::string_view name) const
 {
-	std::list<RTTR::NormalMethodInfo> methods;
-	auto pair{ m_impl->normalMethods.equal_range(name) };
-	while (pair.first != pair.second) methods.push_back(pair.first++->second);
-	return methods;
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().normalMethods.find(name);
+}
+
+const RTTR::NormalMethodInfo* RTTR::RTTRInfo::normalMethod(std::string_view name, Signature signature) const
+{
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().normalMethods.find(name, signature);
 }
 
 bool RTTR::RTTRInfo::registerConstMethod(const ConstMethodInfo& info)
 {
-	if (auto methods{ constMethod(info.name) }; std::find_if(methods.begin(), methods.end(), RTTRInfoImpl::AddressEqual{ info.address }) == methods.end())
+	auto lock{ RTTRInfoImpl::writeLock(*this) };
+	if (!lock) return false;
+
+	return RTTRInfoImpl::registerMethod(impl().constMethods, info, this);
+}
+
+std::span<const std::string_view> RTTR::RTTRInfo::constMethodNames() const
+{
+	materialize();
+	return impl().constMethods.names.span();
+}
+
+const RTTR::ArenaArray<RTTR::ConstMethodInfo>& RTTR::RTTRInfo::constMethods() const
+{
+	materialize();
+	return impl().constMethods.list;
+}
+
+std::span<const RTTR::ConstMethodInfo* const> RTTR::RTTRInfo::constMethod(std::string_view name) const
+{
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().constMethods.find(name);
+}
+
+const RTTR::ConstMethodInfo* RTTR::RTTRInfo::constMethod(std::string_view name, Signature signature) const
+{
+	materialize();
+	auto lock{ RTTRInfoImpl::readLock() };
+	return impl().constMethods.find(name, signature);
+}
+
+void RTTR::freeze()
+{
+	//޸ͱִע飻ִڼ߳̿ܵǼµע飬ȷȫִй
+	for (;;)
 	{
-		m_impl->constMethods.insert({ info.name, info });
-		return true;
+		materializeAll();
+
+		std::unique_lock lock{ RTTRInfoImpl::mutex() };
+		if (RTTRInfoImpl::s_frozen.load(std::memory_order_relaxed)) return;
+
+		auto pending{ false };
+		RTTRInfoImpl::infos().forEach([&pending](const RTTRInfo* info) { pending = pending || !info->materialized(); });
+		if (pending) continue;
+
+		//ɵֻͷţⶳڶ̲߳ͷŵڴ
+		static std::list<RTTRInfoImpl::TypeIndex> s_frozenInfos{};
+		RTTRInfoImpl::s_frozen.store(&s_frozenInfos.emplace_back(RTTRInfoImpl::infos()), std::memory_order_release);
+		return;
 	}
-	return false;
 }
 
-std::unordered_set<std::string> RTTR::RTTRInfo::constMethodNames() const
+void RTTR::thaw()
+{
+	std::unique_lock lock{ RTTRInfoImpl::mutex() };
+	RTTRInfoImpl::s_frozen.store(nullptr, std::memory_order_release);
+}
+
+bool RTTR::frozen()
+{
+	return RTTRInfoImpl::s_frozen.load(std::memory_order_acquire) != nullptr;
+}
+
+void RTTR::seal()
+{
+	materializeAll();
+
+	RTTRInfoImpl::sealAll();
+	freeze();
+}
+
+bool RTTR::sealed()
 {
-	std::unordered_set<std::string> names{};
-	for (const auto& [name, info] : m_impl->constMethods) names.insert(name);
-	return names;
+	return RTTRInfoImpl::s_isSealed.load(std::memory_order_acquire);
+}
+
+void RTTR::materializeAll()
+{
+	//עͶھ̬ʼʱǼǣע½ûע飬һμ
+	std::vector<const RTTRInfo*> infos{};
+	{
+		std::shared_lock lock{ RTTRInfoImpl::mutex() };
+		RTTRInfoImpl::infos().forEach([&infos](const RTTRInfo* info) { infos.push_back(info); });
+	}
+
+	for (auto info : infos) info->materialize();
 }
 
-std::list<RTTR::ConstMethodInfo> RTTR::RTTRInfo::constMethod(const std::string& name) const
+RTTR::AllocationHook RTTR::setAllocationHook(AllocationHook hook)
 {
-	std::list<RTTR::ConstMethodInfo> methods;
-	auto pair{ m_impl->constMethods.equal_range(name) };
-	while (pair.first != pair.second) methods.push_back(pair.first++->second);
-	return methods;
+	return RTTRInfoImpl::s_allocationHook.exchange(hook, std::memory_order_acq_rel);
 }
@@ -2,28 +2,53 @@
 
 #include <assert.h>
 
-#include <memory>
-#include <optional>
-#include <unordered_set>
+#include <atomic>
+#include <span>
+#include <string_view>
 
+#include "RTTRArena/RTTRArena.hpp"
 #include "RTTRCore/RTTRCore.hpp"
 
 namespace RTTR
 {
 	class RTTRInfoImpl;
+	class Pool;
+	class BinaryWriter;
+	class BinaryReader;
+	class JsonWriter;
+	class JsonReader;
 	
 	/// <summary>
 	/// Ϣ
+	/// ע׶עѯȫֶдɲУfreeze()֮עᱻܾѯټ
+	/// ڴصķֶУͳһȫַֻͬһ
+	/// صĳԱ/ָʼЧصͼõfreeze()֮ûвעʱʹ
+	/// Աڵһעѯʱŷ䣻ӳٵעڵһβѯԱ캯ʱִ
 	/// </summary>
 	class RTTRInfo
 	{
+		friend class RTTRInfoImpl;
+
+	public:
+		/// <summary>
+		/// ӳִеע
+		/// </summary>
+		using Registrar = void (*)(RTTRInfo& info);
+
 	public:
 		/// <summary>
 		/// ȡһϢ
 		/// </summary>
 		/// <param name="name"></param>
 		/// <returns></returns>
-		static RTTRInfo* info(const std::string& name);
+		static RTTRInfo* info(std::string_view name);
+
+		/// <summary>
+		/// ȡһϢ
+		/// </summary>
+		/// <param name="id"></param>
+		/// <returns></returns>
+		static RTTRInfo* info(TypeId id);
 
 	protected:
 		/// <summary>
@@ -34,15 +59,21 @@ namespace RTTR
 		static bool registerRTTRInfo(RTTRInfo* info);
 
 	public:
-		RTTRInfo();
+		RTTRInfo(TypeId id, std::string_view name);
 		virtual ~RTTRInfo();
 
 	public:
+		/// <summary>
+		/// ȡID
+		/// </summary>
+		/// <returns></returns>
+		TypeId id() const { return m_id; }
+
 		/// <summary>
 		/// ȡ
 		/// </summary>
 		/// <returns></returns>
-		virtual std::string name() const = 0;
+		std::string_view name() const { return m_name; }
 
 		/// <summary>
 		/// ȡʹС
@@ -50,7 +81,227 @@ namespace RTTR
 		/// <returns></returns>
 		virtual size_t size() const = 0;
 
+		/// <summary>
+		/// ȡͶ
+		/// </summary>
+		/// <returns></returns>
+		virtual size_t alignment() const = 0;
+
+		/// <summary>
+		/// 󣬲ͷŴ洢
+		/// </summary>
+		/// <param name="o"></param>
+		virtual void destruct(void* o) const = 0;
+
+		/// <summary>
+		/// memoryoƹ
+		/// </summary>
+		/// <param name="memory">δʼĴ洢</param>
+		/// <param name="o">Դ</param>
+		/// <returns>Ͳɸʱfalse</returns>
+		virtual bool copyConstruct(void*, const void*) const { return false; }
+
+		/// <summary>
+		/// memoryoƶo
+		/// </summary>
+		/// <param name="memory">δʼĴ洢</param>
+		/// <param name="o">Դ</param>
+		/// <returns>Ͳƶʱfalse</returns>
+		virtual bool moveConstruct(void*, void*) const { return false; }
+
+		/// <summary>
+		/// valueƸֵo
+		/// </summary>
+		/// <returns>ͲɸƸֵʱfalse</returns>
+		virtual bool copyAssign(void*, const void*) const { return false; }
+
+		/// <summary>
+		/// valueƶֵo
+		/// </summary>
+		/// <returns>Ͳƶֵʱfalse</returns>
+		virtual bool moveAssign(void*, void*) const { return false; }
+
+		/// <summary>
+		/// ǷƽƣƽƵĳԱлȼƻаֽδ
+		/// </summary>
+		/// <returns></returns>
+		virtual bool trivial() const { return false; }
+
+		/// <summary>
+		/// ֵǷֻֽھmemcmpȽ밴ֽڹϣRTTR::bytewise
+		/// </summary>
+		/// <returns></returns>
+		virtual bool bytewise() const { return false; }
+
+		/// <summary>
+		/// ȽĬϰעͨԱȽ
+		/// </summary>
+		/// <param name="lhs"></param>
+		/// <param name="rhs"></param>
+		/// <returns></returns>
+		virtual bool equals(const void* lhs, const void* rhs) const;
+
+		/// <summary>
+		/// ĹϣֵĬϰעͨԱ㣬equals()ȵĶϣֵͬ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns></returns>
+		virtual size_t hash(const void* o) const;
+
+		/// <summary>
+		/// лĬϰעͨԱл
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="writer"></param>
+		virtual void serialize(const void* o, BinaryWriter& writer) const;
+
+		/// <summary>
+		/// лѹĶĬϰעͨԱл
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="reader"></param>
+		/// <returns>ݲʱfalse</returns>
+		virtual bool deserialize(void* o, BinaryReader& reader) const;
+
+		/// <summary>
+		/// ΪJSONĬϰעͨԱΪ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="writer"></param>
+		virtual void writeJson(const void* o, JsonWriter& writer) const;
+
+		/// <summary>
+		/// JSON뵽ѹĶĬϰעͨԱ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="reader"></param>
+		/// <returns>ʽʱfalse</returns>
+		virtual bool readJson(void* o, JsonReader& reader) const;
+
+		/// <summary>
+		/// ȡPݣлƻ
+		/// ״εʱbuild(*this)֮ȡʱʹõʱעĳԱӦڸעɺʹ
+		/// ǰPlanSlotsݴϢڣڰĲλ
+		/// </summary>
+		/// <typeparam name="P"></typeparam>
+		/// <param name="build"></param>
+		/// <returns></returns>
+		template<typename P, typename Build>
+		const P& plan(Build build) const
+		{
+			static const size_t s_slot{ s_planSlots.fetch_add(1) };
+
+			auto& cache{ s_slot < PlanSlots ? m_plans[s_slot] : overflowPlan(s_slot - PlanSlots) };
+			if (auto cached{ cache.load(std::memory_order_acquire) }) return *static_cast<const P*>(cached);
+
+			//ʱֻһݣඪļƻϢͬڣͷ
+			auto built{ new P(build(*this)) };
+			const void* expected{ nullptr };
+			if (cache.compare_exchange_strong(expected, built, std::memory_order_acq_rel)) return *built;
+
+			delete built;
+			return *static_cast<const P*>(expected);
+		}
+
 	public:
+		/// <summary>
+		/// Ǽӳִеע飬ʱֻ¼ָ룬һβѯʱŽԱ뷽
+		/// </summary>
+		/// <param name="registrar">ע飬ִʱֱӵøregisterXxx</param>
+		/// <returns>Ѷδִеעʱfalse</returns>
+		bool registerLazy(Registrar registrar);
+
+		/// <summary>
+		/// ӳٵעǷִУûеǼעʱΪtrue
+		/// </summary>
+		/// <returns></returns>
+		bool materialized() const { return m_registrar.load(std::memory_order_acquire) == nullptr; }
+
+		/// <summary>
+		/// ִӳٵע飬ѯӿڻԶãǰִע
+		/// עֻעᵽͣעᵽʱܾ
+		/// ʱִֻһΣõȴִ
+		/// </summary>
+		void materialize() const
+		{
+			if (!materialized()) [[unlikely]] runRegistrar();
+		}
+
+		/// <summary>
+		/// ִע飬ִڼעֻעᵽͣӰregisterLazyǼǵע
+		/// </summary>
+		/// <param name="registrar"></param>
+		void registerWith(Registrar registrar);
+
+	public:
+		/// <summary>
+		/// עṹ캯ͬǩĹ캯ֻעһ
+		/// </summary>
+		/// <param name="info"></param>
+		/// <returns></returns>
+		bool registerConstructor(const ConstructorInfo& info);
+
+		/// <summary>
+		/// ע˳й캯
+		/// </summary>
+		/// <returns></returns>
+		const ArenaArray<ConstructorInfo>& constructors() const;
+
+		/// <summary>
+		/// ǩȡ캯
+		/// </summary>
+		/// <param name="signature">voidͼ</param>
+		/// <returns>Ҳʱnullptr</returns>
+		const ConstructorInfo* constructor(Signature signature) const;
+
+		/// <summary>
+		/// Ϊöأ֮create()/allocate()ӳз
+		/// ڵһη֮ǰ
+		/// </summary>
+		/// <param name="objectsPerChunk">ÿĶ</param>
+		/// <returns>áѴͨöѷѶʱfalse</returns>
+		bool registerPool(size_t objectsPerChunk);
+
+		/// <summary>
+		/// ȡ
+		/// </summary>
+		/// <returns>δʱnullptr</returns>
+		const Pool* pool() const;
+
+		/// <summary>
+		/// һδʼ洢öʱӳз
+		/// </summary>
+		/// <returns></returns>
+		void* allocate() const;
+
+		/// <summary>
+		/// 黹allocate()Ĵ洢
+		/// </summary>
+		/// <param name="memory"></param>
+		void deallocate(void* memory) const;
+
+		/// <summary>
+		/// 䲢Բ󣬲עĹ캯һ
+		/// </summary>
+		/// <param name="...args"></param>
+		/// <returns>ûƥĹ캯ʱnullptr</returns>
+		template<typename... Args>
+		void* create(Args&&... args) const;
+
+		/// <summary>
+		/// 䲢ͲĲ
+		/// </summary>
+		/// <param name="constructor">͵Ĺ캯</param>
+		/// <param name="args">ָ</param>
+		/// <returns></returns>
+		void* create(const ConstructorInfo& constructor, void** args) const;
+
+		/// <summary>
+		/// 黹create()Ķ
+		/// </summary>
+		/// <param name="o"></param>
+		void destroy(void* o) const;
+
 		/// <summary>
 		/// עḸϢ
 		/// </summary>
@@ -61,14 +312,99 @@ namespace RTTR
 		/// ȡ
 		/// </summary>
 		/// <returns></returns>
-		std::list<std::string> superclassNames() const;
+		std::span<const std::string_view> superclassNames() const;
+
+		/// <summary>
+		/// ע˳и
+		/// </summary>
+		/// <returns></returns>
+		const ArenaArray<Superclass>& superclasses() const;
+
+		/// <summary>
+		/// ȡϢ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <returns>Ҳʱnullptr</returns>
+		const Superclass* superclass(std::string_view name) const;
 
 		/// <summary>
 		/// ȡϢ
 		/// </summary>
+		/// <param name="id"></param>
+		/// <returns>Ҳʱnullptr</returns>
+		const Superclass* superclass(TypeId id) const;
+
+		/// <summary>
+		/// ࣬һΪ󰴼̳оɽԶ
+		/// ״εûĳȵǼ¸״εʱչ棬˺ȡ
+		/// </summary>
+		/// <returns></returns>
+		std::span<const Ancestor> ancestors() const;
+
+		/// <summary>
+		/// ȡϢO(1)
+		/// </summary>
+		/// <param name="id"></param>
+		/// <returns>ʱnullptr</returns>
+		const Ancestor* ancestor(TypeId id) const;
+
+		/// <summary>
+		/// ǷΪbase
+		/// </summary>
+		/// <param name="base"></param>
+		/// <returns></returns>
+		bool isA(const RTTRInfo* base) const { return base && ancestor(base->id()) != nullptr; }
+
+		/// <summary>
+		/// ѵǰ͵ĶָתΪbaseָ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <param name="base"></param>
+		/// <returns>Ȼδ֪ʱnullptr</returns>
+		void* upcast(void* o, const RTTRInfo* base) const;
+
+		/// <summary>
+		/// ѵǰ͵ָתΪderivedָ룬static_castһʵ
+		/// </summary>
+		/// <param name="o">derivedеĵǰӶ</param>
+		/// <param name="derived"></param>
+		/// <returns>δ֪ʱnullptr</returns>
+		void* downcast(void* o, const RTTRInfo* derived) const;
+
+		/// <summary>
+		/// ؼ̳йϵҾ̬ԱͬԱظ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <returns></returns>
+		Inherited<const StaticMemberInfo*> inheritedStaticMember(std::string_view name) const;
+
+		/// <summary>
+		/// ؼ̳йϵͨԱoffsetΪָ뵽ĵ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <returns></returns>
+		Inherited<const NormalMemberInfo*> inheritedNormalMember(std::string_view name) const;
+
+		/// <summary>
+		/// ؼ̳йϵҾ̬е
+		/// </summary>
+		/// <param name="name"></param>
+		/// <returns></returns>
+		Inherited<std::span<const StaticMethodInfo* const>> inheritedStaticMethod(std::string_view name) const;
+
+		/// <summary>
+		/// ؼ̳йϵͨǰadjust()ָ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <returns></returns>
+		Inherited<std::span<const NormalMethodInfo* const>> inheritedNormalMethod(std::string_view name) const;
+
+		/// <summary>
+		/// ؼ̳йϵconstǰadjust()ָ
+		/// </summary>
 		/// <param name="name"></param>
 		/// <returns></returns>
-		std::optional<Superclass> superclass(const std::string& name) const;
+		Inherited<std::span<const ConstMethodInfo* const>> inheritedConstMethod(std::string_view name) const;
 
 		/// <summary>
 		/// עᾲ̬ԱϢ
@@ -81,14 +417,37 @@ namespace RTTR
 		/// ȡо̬Ա
 		/// </summary>
 		/// <returns></returns>
-		std::list<std::string> staticMemberNames() const;
+		std::span<const std::string_view> staticMemberNames() const;
+
+		/// <summary>
+		/// ע˳о̬Ա
+		/// </summary>
+		/// <returns></returns>
+		const ArenaArray<StaticMemberInfo>& staticMembers() const;
 
 		/// <summary>
 		/// ȡ̬ԱϢ
 		/// </summary>
 		/// <param name="name"></param>
-		/// <returns></returns>
-		std::optional<StaticMemberInfo> staticMember(const std::string& name) const;
+		/// <returns>Ҳʱnullptr</returns>
+		const StaticMemberInfo* staticMember(std::string_view name) const;
+
+		/// <summary>
+		/// ñ٣offsetΪDirtyBits֮עͨԱעŶӦһλ
+		/// עͨԱ֮ǰ
+		/// </summary>
+		/// <param name="offset">DirtyBitsԶʼַƫ</param>
+		/// <param name="capacity">λĳԱ</param>
+		/// <returns>áעͨԱѶʱfalse</returns>
+		bool registerDirtyBits(int offset, size_t capacity);
+
+		/// <summary>
+		/// ıλiλӦעΪiͨԱ
+		/// </summary>
+		/// <param name="o"></param>
+		/// <returns>δñʱΪ</returns>
+		std::span<uint64_t> dirtyBits(void* o) const;
+		std::span<const uint64_t> dirtyBits(const void* o) const;
 
 		/// <summary>
 		/// עͨԱϢ
@@ -101,14 +460,20 @@ namespace RTTR
 		/// ȡͨԱ
 		/// </summary>
 		/// <returns></returns>
-		std::list<std::string> normalMemberNames() const;
+		std::span<const std::string_view> normalMemberNames() const;
+
+		/// <summary>
+		/// ע˳ͨԱ
+		/// </summary>
+		/// <returns></returns>
+		const ArenaArray<NormalMemberInfo>& normalMembers() const;
 
 		/// <summary>
 		/// ȡͨԱϢ
 		/// </summary>
 		/// <param name="name"></param>
-		/// <returns></returns>
-		std::optional<NormalMemberInfo> normalMember(const std::string& name) const;
+		/// <returns>Ҳʱnullptr</returns>
+		const NormalMemberInfo* normalMember(std::string_view name) const;
 
 		/// <summary>
 		/// עᾲ̬
@@ -121,14 +486,28 @@ namespace RTTR
 		/// ȡо̬
 		/// </summary>
 		/// <returns></returns>
-		std::unordered_set<std::string> staticMethodNames() const;
+		std::span<const std::string_view> staticMethodNames() const;
+
+		/// <summary>
+		/// ע˳о̬()
+		/// </summary>
+		/// <returns></returns>
+		const ArenaArray<StaticMethodInfo>& staticMethods() const;
 
 		/// <summary>
 		/// ȡ̬Ϣ
 		/// </summary>
 		/// <param name="name"></param>
-		/// <returns></returns>
-		std::list<StaticMethodInfo> staticMethod(const std::string& name) const;
+		/// <returns>أҲʱΪ</returns>
+		std::span<const StaticMethodInfo* const> staticMethod(std::string_view name) const;
+
+		/// <summary>
+		/// ǩȡ̬Ϣ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <param name="signature"></param>
+		/// <returns>Ҳʱnullptr</returns>
+		const StaticMethodInfo* staticMethod(std::string_view name, Signature signature) const;
 
 		/// <summary>
 		/// עͨϢ
@@ -141,14 +520,28 @@ namespace RTTR
 		/// ȡͨ
 		/// </summary>
 		/// <returns></returns>
-		std::unordered_set<std::string> normalMethodNames() const;
+		std::span<const std::string_view> normalMethodNames() const;
+
+		/// <summary>
+		/// ע˳ͨ()
+		/// </summary>
+		/// <returns></returns>
+		const ArenaArray<NormalMethodInfo>& normalMethods() const;
 
 		/// <summary>
 		/// ȡͨϢ
 		/// </summary>
 		/// <param name="name"></param>
-		/// <returns></returns>
-		std::list<NormalMethodInfo> normalMethod(const std::string& name) const;
+		/// <returns>أҲʱΪ</returns>
+		std::span<const NormalMethodInfo* const> normalMethod(std::string_view name) const;
+
+		/// <summary>
+		/// ǩȡͨϢ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <param name="signature"></param>
+		/// <returns>Ҳʱnullptr</returns>
+		const NormalMethodInfo* normalMethod(std::string_view name, Signature signature) const;
 
 		/// <summary>
 		/// עconstϢ
@@ -161,28 +554,187 @@ namespace RTTR
 		/// ȡconst
 		/// </summary>
 		/// <returns></returns>
-		std::unordered_set<std::string> constMethodNames() const;
+		std::span<const std::string_view> constMethodNames() const;
+
+		/// <summary>
+		/// ע˳const()
+		/// </summary>
+		/// <returns></returns>
+		const ArenaArray<ConstMethodInfo>& constMethods() const;
 
 		/// <summary>
 		/// ȡconstϢ
 		/// </summary>
 		/// <param name="name"></param>
+		/// <returns>أҲʱΪ</returns>
+		std::span<const ConstMethodInfo* const> constMethod(std::string_view name) const;
+
+		/// <summary>
+		/// ǩȡconstϢ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <param name="signature"></param>
+		/// <returns>Ҳʱnullptr</returns>
+		const ConstMethodInfo* constMethod(std::string_view name, Signature signature) const;
+
+	private:
+		/// <summary>
+		/// ִвӳٵע
+		/// </summary>
+		void runRegistrar() const;
+
+		/// <summary>
+		/// ȡԱһʹʱ
+		/// </summary>
 		/// <returns></returns>
-		std::list<ConstMethodInfo> constMethod(const std::string& name) const;
+		RTTRInfoImpl& impl() const
+		{
+			auto impl{ m_impl.load(std::memory_order_acquire) };
+			return impl ? *impl : allocateImpl();
+		}
+
+		RTTRInfoImpl& allocateImpl() const;
+
+		/// <summary>
+		/// λݲλλڴУͷ
+		/// </summary>
+		/// <param name="slot">0ʼλ</param>
+		/// <returns></returns>
+		std::atomic<const void*>& overflowPlan(size_t slot) const;
+
+	private:
+		static constexpr size_t PlanSlots{ 8 };
+		static inline std::atomic<size_t> s_planSlots{ 0 };
+
+		struct PlanChunk;
 
 	private:
-		std::unique_ptr<RTTRInfoImpl> m_impl{};
+		const TypeId m_id;
+		const std::string_view m_name;
+		mutable std::atomic<RTTRInfoImpl*> m_impl{ nullptr };	//ڴУͷ
+		mutable std::atomic<Registrar> m_registrar{ nullptr };	//δִеע
+		mutable bool m_materializing{ false };					//עִУmaterialize
+		mutable std::atomic<const void*> m_plans[PlanSlots]{};	//plan()
+		mutable std::atomic<PlanChunk*> m_morePlans{ nullptr };	//m_plansݣÿPlanSlots
 	};
 
+	/// <summary>
+	/// ȫעֻͱ
+	/// ǰִӳٵע飬˺עȫʧܣ̵߳Ĳѯټ
+	/// </summary>
+	void freeze();
+
+	/// <summary>
+	/// ⶳעָע׶
+	/// ֻû̲߳ѯʱã֮زǰ
+	/// </summary>
+	void thaw();
+
+	/// <summary>
+	/// עǷѶ
+	/// </summary>
+	/// <returns></returns>
+	bool frozen();
+
+	/// <summary>
+	/// ִע͵ӳע飬ڶǰԤȻͳڴ
+	/// </summary>
+	void materializeAll();
+
+	/// <summary>
+	/// ִӳע飬Ϊ͵ĳԱСϣȻ󶳽
+	/// ˺ֲֻһιϣһ̽һαȽϣĿٵıʹÿѰַС
+	/// ⶳȻЧעµͻĿʱӦı˻ͨ
+	/// </summary>
+	void seal();
+
+	/// <summary>
+	/// Ƿseal()֮ûעµ
+	/// </summary>
+	/// <returns></returns>
+	bool sealed();
+
+	/// <summary>
+	/// ͨöѷصRTTRInfo::allocate()δöضͨöѷʱãͳ
+	/// </summary>
+	using AllocationHook = void (*)(const RTTRInfo& info, size_t size);
+
+	/// <summary>
+	/// ͨöѷصnullptrΪȡ
+	/// </summary>
+	/// <param name="hook"></param>
+	/// <returns>ԭĻص</returns>
+	AllocationHook setAllocationHook(AllocationHook hook);
+
 	template<typename T>
 	class RealRTTRInfo : public RTTRInfo { };
 
+	template<typename M>
+	bool isType(const RTTRInfo* info) { return info && info->id() == RealRTTRInfo<std::remove_cvref_t<M>>::typeId; }
+
 	/// <summary>
 	/// ȡϢ
 	/// </summary>
 	/// <typeparam name="...Args"></typeparam>
+	/// <returns>ָ̬飬ͬ</returns>
+	template<typename... Args>
+	static std::span<RTTRInfo* const> unpackArgsInfo()
+	{
+		if constexpr (sizeof...(Args) == 0) return {};
+		else
+		{
+			static RTTRInfo* const s_args[]{ RealRTTRInfo<Args>::instance()... };
+			return s_args;
+		}
+	}
+
+	/// <summary>
+	/// ɷֵͼǩָ
+	/// </summary>
+	/// <typeparam name="R">ֵ</typeparam>
+	/// <typeparam name="...Args"></typeparam>
 	/// <returns></returns>
+	template<typename R, typename... Args>
+	constexpr Signature makeSignature()
+	{
+		Signature signature{ RealRTTRInfo<R>::typeId };
+		((signature = (signature ^ RealRTTRInfo<Args>::typeId) * 1099511628211ull), ...);
+		return signature;
+	}
+
+	template<typename... Args, typename T>
+	ConstructorInfo ConstructorInfo::of(Interview interview, std::type_identity<T>)
+	{
+		void (*callable)(void*, Args...){ &RTTR::construct<T, Args...> };
+		return { interview, &RTTR::constructor<T, Args...>, reinterpret_cast<void (*)()>(callable), &typeid(callable), unpackArgsInfo<Args...>(), makeSignature<void, Args...>() };
+	}
+
 	template<typename... Args>
-	static std::list<RTTRInfo*> unpackArgsInfo() { return { RealRTTRInfo<Args>::instance()... }; }
+	void* RTTRInfo::create(Args&&... args) const
+	{
+		auto constructor{ this->constructor(makeSignature<void, std::remove_cvref_t<Args>...>()) };
+		if (nullptr == constructor) return nullptr;
+
+		auto memory{ allocate() };
+		try
+		{
+			constructor->construct(memory, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			deallocate(memory);
+			throw;
+		}
+		return memory;
+	}
+
+	template<typename R, typename... Args>
+	struct signature_traits<R(*)(Args...)> { static constexpr Signature value{ makeSignature<R, Args...>() }; };
+
+	template<typename R, typename C, typename... Args>
+	struct signature_traits<R(C::*)(Args...)> { static constexpr Signature value{ makeSignature<R, Args...>() }; };
+
+	template<typename R, typename C, typename... Args>
+	struct signature_traits<R(C::*)(Args...) const> { static constexpr Signature value{ makeSignature<R, Args...>() }; };
 }
 
@@ -1,23 +1,32 @@
 #pragma once
 
+#include <functional>
+
 #include "RTTRInfo/RTTRInfo.h"
 
 namespace RTTR
 {
 	/// <summary>
-	/// ԱϢбǷͬ
+	/// Fǩҷ
 	/// </summary>
-	/// <typeparam name="...Args"></typeparam>
-	template<typename... Args>
-	struct ArgsEqual
+	/// <typeparam name="T">Ϣ</typeparam>
+	/// <typeparam name="F"></typeparam>
+	/// <param name="name"></param>
+	/// <param name="method"></param>
+	/// <param name="find">RTTRInfoаǩҵĳԱ</param>
+	/// <returns>ͻƥزʱ׳std::bad_function_call</returns>
+	template<typename T, typename F>
+	static const T& findMethod(std::string_view name, std::string_view method, const T* (RTTRInfo::*find)(std::string_view, Signature) const)
 	{
-	public:
-		template<typename T>
-		bool operator ()(const T& value) { return value.args == args; }
-
-	private:
-		std::list<RTTRInfo*> args{ unpackArgsInfo<Args...>() };
-	};
+		auto info{ RTTRInfo::info(name) };
+		auto methodInfo{ info ? (info->*find)(method, signature_traits<F>::value) : nullptr };
+		if (nullptr == methodInfo)
+		{
+			RTTR_PROFILE_MISS(info);
+			throw std::bad_function_call{};
+		}
+		return *methodInfo;
+	}
 
 	/// <summary>
 	/// þ̬
@@ -29,10 +38,10 @@ namespace RTTR
 	/// <param name="...args"></param>
 	/// <returns></returns>
 	template<typename F, typename... Args>
-	static auto invokeStaticMethod(const std::string& name, const std::string& method, Args&&... args) -> std::invoke_result_t<F>
+	static auto invokeStaticMethod(std::string_view name, std::string_view method, Args&&... args) -> std::invoke_result_t<F, Args...>
 	{
-		auto methodInfos{ RTTRInfo::info(name)->staticMethod(method) };
-		return std::find_if(methodInfos.begin(), methodInfos.end(), ArgsEqual<Args...>{})->invoke<F>(std::forward<Args>(args)...);
+		const auto& methodInfo{ findMethod<StaticMethodInfo, F>(name, method, &RTTRInfo::staticMethod) };
+		return methodInfo.template invoke<F>(std::forward<Args>(args)...);
 	}
 
 	/// <summary>
@@ -67,12 +76,12 @@ namespace RTTR
 	/// <param name="...args"></param>
 	/// <returns></returns>
 	template<typename F, typename... Args, typename Traits = member_method_traits<F>>
-	static auto invokeNormalMethod(void* o, const std::string& name, const std::string& method, Args... args) -> std::invoke_result_t<F, typename Traits::class_t>
+	static auto invokeNormalMethod(void* o, std::string_view name, std::string_view method, Args... args) -> std::invoke_result_t<F, typename Traits::class_t*, Args...>
 	{
 		static_assert(!Traits::is_const::value, "Method is const");
 
-		auto methodInfos{ RTTRInfo::info(name)->normalMethod(method) };
-		return std::find_if(methodInfos.begin(), methodInfos.end(), ArgsEqual<Args...>{})->invoke<F>(reinterpret_cast<Traits::class_t*>(o), std::forward<Args>(args)...);
+		const auto& methodInfo{ findMethod<NormalMethodInfo, F>(name, method, &RTTRInfo::normalMethod) };
+		return methodInfo.template invoke<F>(reinterpret_cast<typename Traits::class_t*>(o), std::forward<Args>(args)...);
 	}
 
 	/// <summary>
@@ -86,12 +95,12 @@ namespace RTTR
 	/// <param name="...args"></param>
 	/// <returns></returns>
 	template<typename F, typename... Args, typename Traits = member_method_traits<F>>
-	static auto invokeConstMethod(const void* o, const std::string& name, const std::string& method, Args... args) -> std::invoke_result_t<F, typename Traits::class_t>
+	static auto invokeConstMethod(const void* o, std::string_view name, std::string_view method, Args... args) -> std::invoke_result_t<F, typename Traits::class_t*, Args...>
 	{
 		static_assert(Traits::is_const::value, "Method is not const");
 
-		auto methodInfos{ RTTRInfo::info(name)->constMethod(method) };
-		return std::find_if(methodInfos.begin(), methodInfos.end(), ArgsEqual<Args...>{})->invoke<F>(reinterpret_cast<Traits::class_t*>(o), std::forward<Args>(args)...);
+		const auto& methodInfo{ findMethod<ConstMethodInfo, F>(name, method, &RTTRInfo::constMethod) };
+		return methodInfo.template invoke<F>(reinterpret_cast<typename Traits::class_t*>(o), std::forward<Args>(args)...);
 	}
 
 	/// <summary>
@@ -102,7 +111,7 @@ namespace RTTR
 	/// <param name="member">Ա</param>
 	/// <returns></returns>
 	template<typename M>
-	static M valueStaticMember(const std::string& name, const std::string& member)
+	static M valueStaticMember(std::string_view name, std::string_view member)
 	{
 		return RTTRInfo::info(name)->staticMember(member)->value<M>();
 	}
@@ -116,9 +125,170 @@ namespace RTTR
 	/// <param name="member">Ա</param>
 	/// <returns></returns>
 	template<typename M>
-	static M valueNormalMember(void* o, const std::string& name, const std::string& member)
+	static M valueNormalMember(void* o, std::string_view name, std::string_view member)
 	{
 		return RTTRInfo::info(name)->normalMember(member)->value<M>(o);
 	}
-}
 
+	/// <summary>
+	/// ȡ̬Ա
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <returns></returns>
+	template<typename M>
+	static M& refStaticMember(std::string_view name, std::string_view member)
+	{
+		return RTTRInfo::info(name)->staticMember(member)->ref<M>();
+	}
+
+	/// <summary>
+	/// þ̬Աֵ
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <param name="value">ֵֵƶֵд</param>
+	template<typename M, typename V>
+	static void setStaticMember(std::string_view name, std::string_view member, V&& value)
+	{
+		RTTRInfo::info(name)->staticMember(member)->set<M>(std::forward<V>(value));
+	}
+
+	/// <summary>
+	/// ȡͨԱ
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="o"></param>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <returns></returns>
+	template<typename M>
+	static M& refNormalMember(void* o, std::string_view name, std::string_view member)
+	{
+		return RTTRInfo::info(name)->normalMember(member)->ref<M>(o);
+	}
+
+	/// <summary>
+	/// ȡͨԱconst
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="o"></param>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <returns></returns>
+	template<typename M>
+	static const M& crefNormalMember(const void* o, std::string_view name, std::string_view member)
+	{
+		return RTTRInfo::info(name)->normalMember(member)->cref<M>(o);
+	}
+
+	/// <summary>
+	/// ͨԱֵ
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="o"></param>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <param name="value">ֵֵƶֵд</param>
+	template<typename M, typename V>
+	static void setNormalMember(void* o, std::string_view name, std::string_view member, V&& value)
+	{
+		RTTRInfo::info(name)->normalMember(member)->set<M>(o, std::forward<V>(value));
+	}
+
+	/// <summary>
+	/// ӶȡͨԱΪʹС
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="objects"></param>
+	/// <param name="count"></param>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <param name="out">countԪ</param>
+	template<typename M>
+	static void gatherNormalMember(const void* objects, size_t count, std::string_view name, std::string_view member, M* out)
+	{
+		auto info{ RTTRInfo::info(name) };
+		info->normalMember(member)->gather(objects, count, info->size(), out);
+	}
+
+	/// <summary>
+	/// ֵдضеͨԱΪʹС
+	/// </summary>
+	/// <typeparam name="M">Ա</typeparam>
+	/// <param name="objects"></param>
+	/// <param name="count"></param>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <param name="in">countԪ</param>
+	template<typename M>
+	static void scatterNormalMember(void* objects, size_t count, std::string_view name, std::string_view member, const M* in)
+	{
+		auto info{ RTTRInfo::info(name) };
+		info->normalMember(member)->scatter(objects, count, info->size(), in);
+	}
+
+	/// <summary>
+	/// nameǷΪbase
+	/// </summary>
+	/// <param name="name"></param>
+	/// <param name="base"></param>
+	/// <returns></returns>
+	inline bool isA(std::string_view name, std::string_view base)
+	{
+		auto info{ RTTRInfo::info(name) };
+		return info && info->ancestor(typeId(base)) != nullptr;
+	}
+
+	/// <summary>
+	/// ѶָתΪָ
+	/// </summary>
+	/// <param name="o"></param>
+	/// <param name="name"></param>
+	/// <param name="base"></param>
+	/// <returns>Ǹδ֪ʱnullptr</returns>
+	inline void* upcast(void* o, std::string_view name, std::string_view base)
+	{
+		auto info{ RTTRInfo::info(name) };
+		return info ? info->upcast(o, RTTRInfo::info(base)) : nullptr;
+	}
+
+	/// <summary>
+	/// ѸָתΪָ룬ʵ
+	/// </summary>
+	/// <param name="o">еĸӶ</param>
+	/// <param name="name"></param>
+	/// <param name="derived"></param>
+	/// <returns>δ֪ʱnullptr</returns>
+	inline void* downcast(void* o, std::string_view name, std::string_view derived)
+	{
+		auto info{ RTTRInfo::info(name) };
+		return info ? info->downcast(o, RTTRInfo::info(derived)) : nullptr;
+	}
+
+	/// <summary>
+	/// 䲢󣬲עĹ캯һ
+	/// </summary>
+	/// <typeparam name="...Args"></typeparam>
+	/// <param name="name"></param>
+	/// <param name="...args"></param>
+	/// <returns>ͻƥĹ캯ʱnullptr</returns>
+	template<typename... Args>
+	static void* create(std::string_view name, Args&&... args)
+	{
+		auto info{ RTTRInfo::info(name) };
+		return info ? info->create(std::forward<Args>(args)...) : nullptr;
+	}
+
+	/// <summary>
+	/// ͷcreate()Ķ
+	/// </summary>
+	/// <param name="o"></param>
+	/// <param name="name"></param>
+	inline void destroy(void* o, std::string_view name)
+	{
+		if (auto info{ RTTRInfo::info(name) }) info->destroy(o);
+	}
+}
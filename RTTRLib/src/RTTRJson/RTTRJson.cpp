@@ -0,0 +1,360 @@
+#include "RTTRJson.hpp"
+#include "RTTRRegister/RTTRBuiltin.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ϢѡԱı뷽ʽ
+	/// </summary>
+	/// <param name="info"></param>
+	/// <returns></returns>
+	static JsonPlan::Kind jsonKind(const RTTRInfo* info)
+	{
+		if (isType<bool>(info)) return JsonPlan::Kind::Bool;
+		if (isType<int>(info)) return JsonPlan::Kind::Int32;
+		if (isType<unsigned int>(info)) return JsonPlan::Kind::UInt32;
+		if (isType<long long>(info)) return JsonPlan::Kind::Int64;
+		if (isType<unsigned long long>(info)) return JsonPlan::Kind::UInt64;
+		if (isType<float>(info)) return JsonPlan::Kind::Float;
+		if (isType<double>(info)) return JsonPlan::Kind::Double;
+		if (isType<std::string>(info)) return JsonPlan::Kind::String;
+		return JsonPlan::Kind::Object;
+	}
+
+	/// <summary>
+	/// 뷽ʽдԱ
+	/// </summary>
+	template<typename Visitor>
+	static auto visitField(const JsonPlan::Field& field, Visitor visitor)
+	{
+		switch (field.kind)
+		{
+		case JsonPlan::Kind::Bool: return visitor(static_cast<bool*>(nullptr));
+		case JsonPlan::Kind::Int32: return visitor(static_cast<int*>(nullptr));
+		case JsonPlan::Kind::UInt32: return visitor(static_cast<unsigned int*>(nullptr));
+		case JsonPlan::Kind::Int64: return visitor(static_cast<long long*>(nullptr));
+		case JsonPlan::Kind::UInt64: return visitor(static_cast<unsigned long long*>(nullptr));
+		case JsonPlan::Kind::Float: return visitor(static_cast<float*>(nullptr));
+		case JsonPlan::Kind::Double: return visitor(static_cast<double*>(nullptr));
+		case JsonPlan::Kind::String: return visitor(static_cast<std::string*>(nullptr));
+		default: return visitor(static_cast<void*>(nullptr));
+		}
+	}
+
+	/// <summary>
+	/// 㰴UTF-8׷ӵַ
+	/// </summary>
+	/// <param name="value"></param>
+	/// <param name="codepoint"></param>
+	static void appendUtf8(std::string& value, uint32_t codepoint)
+	{
+		if (codepoint < 0x80) value.push_back(static_cast<char>(codepoint));
+		else if (codepoint < 0x800)
+		{
+			value.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+			value.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+		}
+		else if (codepoint < 0x10000)
+		{
+			value.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+			value.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+			value.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+		}
+		else
+		{
+			value.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+			value.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+			value.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+			value.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+		}
+	}
+
+	/// <summary>
+	/// ȡ\u4λʮ
+	/// </summary>
+	static bool readHex4(const char*& cursor, const char* end, uint32_t& value)
+	{
+		if (end - cursor < 4) return false;
+
+		value = 0;
+		for (int i = 0; i < 4; ++i)
+		{
+			auto c{ *cursor++ };
+			value <<= 4;
+			if (c >= '0' && c <= '9') value |= c - '0';
+			else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+			else return false;
+		}
+		return true;
+	}
+}
+
+void RTTR::JsonWriter::writeString(std::string_view text)
+{
+	static constexpr char Hex[]{ "0123456789abcdef" };
+
+	m_buffer.push_back('"');
+	size_t run{ 0 };		//δдתƬ
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		auto c{ static_cast<unsigned char>(text[i]) };
+		if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+		m_buffer.append(text.data() + run, i - run);
+		run = i + 1;
+		switch (c)
+		{
+		case '"': m_buffer.append("\\\""); break;
+		case '\\': m_buffer.append("\\\\"); break;
+		case '\n': m_buffer.append("\\n"); break;
+		case '\r': m_buffer.append("\\r"); break;
+		case '\t': m_buffer.append("\\t"); break;
+		case '\b': m_buffer.append("\\b"); break;
+		case '\f': m_buffer.append("\\f"); break;
+		default:
+			m_buffer.append("\\u00");
+			m_buffer.push_back(Hex[c >> 4]);
+			m_buffer.push_back(Hex[c & 0xF]);
+			break;
+		}
+	}
+	m_buffer.append(text.data() + run, text.size() - run);
+	m_buffer.push_back('"');
+}
+
+bool RTTR::JsonReader::readString(std::string& value)
+{
+	value.clear();
+	return consume('"') && decodeString(value);
+}
+
+bool RTTR::JsonReader::readKey(std::string_view& key)
+{
+	if (!consume('"')) return false;
+
+	//ûתļֱ
+	auto begin{ m_cursor };
+	while (m_cursor < m_end && *m_cursor != '"' && *m_cursor != '\\') ++m_cursor;
+	if (m_cursor == m_end) return false;
+	if (*m_cursor == '"')
+	{
+		key = { begin, static_cast<size_t>(m_cursor - begin) };
+		++m_cursor;
+		return true;
+	}
+
+	m_key.assign(begin, m_cursor);
+	if (!decodeString(m_key)) return false;
+	key = m_key;
+	return true;
+}
+
+bool RTTR::JsonReader::readBool(bool& value)
+{
+	skipWhitespace();
+	if (readLiteral("true")) value = true;
+	else if (readLiteral("false")) value = false;
+	else return false;
+	return true;
+}
+
+bool RTTR::JsonReader::readLiteral(std::string_view literal)
+{
+	if (static_cast<size_t>(m_end - m_cursor) < literal.size() || std::string_view{ m_cursor, literal.size() } != literal) return false;
+	m_cursor += literal.size();
+	return true;
+}
+
+bool RTTR::JsonReader::decodeString(std::string& value)
+{
+	while (m_cursor < m_end)
+	{
+		auto begin{ m_cursor };
+		while (m_cursor < m_end && *m_cursor != '"' && *m_cursor != '\\' && static_cast<unsigned char>(*m_cursor) >= 0x20) ++m_cursor;
+		value.append(begin, m_cursor);
+		if (m_cursor == m_end || static_cast<unsigned char>(*m_cursor) < 0x20) return false;
+
+		if (*m_cursor++ == '"') return true;
+		if (m_cursor == m_end) return false;
+
+		switch (*m_cursor++)
+		{
+		case '"': value.push_back('"'); break;
+		case '\\': value.push_back('\\'); break;
+		case '/': value.push_back('/'); break;
+		case 'n': value.push_back('\n'); break;
+		case 'r': value.push_back('\r'); break;
+		case 't': value.push_back('\t'); break;
+		case 'b': value.push_back('\b'); break;
+		case 'f': value.push_back('\f'); break;
+		case 'u':
+		{
+			uint32_t codepoint{ 0 };
+			if (!readHex4(m_cursor, m_end, codepoint)) return false;
+
+			//Ϊһ
+			if (codepoint >= 0xD800 && codepoint < 0xDC00)
+			{
+				uint32_t low{ 0 };
+				if (m_end - m_cursor < 2 || m_cursor[0] != '\\' || m_cursor[1] != 'u') return false;
+				m_cursor += 2;
+				if (!readHex4(m_cursor, m_end, low) || low < 0xDC00 || low >= 0xE000) return false;
+				codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+			}
+			else if (codepoint >= 0xDC00 && codepoint < 0xE000) return false;
+
+			appendUtf8(value, codepoint);
+			break;
+		}
+		default: return false;
+		}
+	}
+	return false;
+}
+
+bool RTTR::JsonReader::skipValue(size_t depth)
+{
+	if (depth >= MaxDepth) return false;
+
+	switch (peek())
+	{
+	case '"':
+	{
+		std::string_view key{};
+		return readKey(key);
+	}
+	case '{':
+		++m_cursor;
+		if (consume('}')) return true;
+		do
+		{
+			std::string_view key{};
+			if (!readKey(key) || !consume(':') || !skipValue(depth + 1)) return false;
+		}
+		while (consume(','));
+		return consume('}');
+	case '[':
+		++m_cursor;
+		if (consume(']')) return true;
+		do
+		{
+			if (!skipValue(depth + 1)) return false;
+		}
+		while (consume(','));
+		return consume(']');
+	case 't': return readLiteral("true");
+	case 'f': return readLiteral("false");
+	case 'n': return readLiteral("null");
+	default:
+	{
+		double number{ 0.0 };
+		return readNumber(number);
+	}
+	}
+}
+
+RTTR::JsonPlan RTTR::JsonPlan::build(const RTTRInfo& info)
+{
+	JsonPlan plan{};
+	for (const auto& member : info.normalMembers())
+	{
+		JsonWriter key{};
+		key.append(plan.fields.empty() ? '{' : ',');
+		key.writeString(member.name);
+		key.append(':');
+		plan.fields.push_back({ std::string{ key.view() }, member.name, member.offset, jsonKind(member.info), member.info });
+	}
+	assert(plan.fields.size() < UINT16_MAX);
+	if (plan.fields.empty()) return plan;
+
+	//ѰʹмͻӣΪԱ2ȡ2ݣҲʱӱ
+	size_t capacity{ 2 };
+	while (capacity < plan.fields.size() * 2) capacity *= 2;
+	for (;; capacity *= 2)
+	{
+		plan.m_slots.assign(capacity, 0);
+		for (uint64_t seed = 0; seed < 256; ++seed)
+		{
+			std::fill(plan.m_slots.begin(), plan.m_slots.end(), uint16_t{ 0 });
+
+			bool perfect{ true };
+			for (size_t i = 0; i < plan.fields.size() && perfect; ++i)
+			{
+				auto& slot{ plan.m_slots[hash(plan.fields[i].name, seed) & (capacity - 1)] };
+				perfect = 0 == slot;
+				slot = static_cast<uint16_t>(i + 1);
+			}
+
+			if (perfect)
+			{
+				plan.m_seed = seed;
+				return plan;
+			}
+		}
+	}
+}
+
+void RTTR::writeJsonMembers(const RTTRInfo& info, const void* o, JsonWriter& writer)
+{
+	writeJsonMembers(info.plan<JsonPlan>(&JsonPlan::build), o, writer);
+}
+
+void RTTR::writeJsonMembers(const JsonPlan& plan, const void* o, JsonWriter& writer)
+{
+	if (plan.fields.empty())
+	{
+		writer.append("{}");
+		return;
+	}
+
+	auto object{ static_cast<const unsigned char*>(o) };
+	for (const auto& field : plan.fields)
+	{
+		writer.append(field.prefix);
+		auto member{ object + field.offset };
+		visitField(field, [&](auto* type)
+			{
+				using M = std::remove_pointer_t<decltype(type)>;
+				if constexpr (std::is_void_v<M>) field.info->writeJson(member, writer);
+				else JsonCodec<M>::write(writer, *reinterpret_cast<const M*>(member));
+			});
+	}
+	writer.append('}');
+}
+
+bool RTTR::readJsonMembers(const RTTRInfo& info, void* o, JsonReader& reader)
+{
+	return readJsonMembers(info.plan<JsonPlan>(&JsonPlan::build), o, reader);
+}
+
+bool RTTR::readJsonMembers(const JsonPlan& plan, void* o, JsonReader& reader)
+{
+	if (!reader.consume('{')) return false;
+	if (reader.consume('}')) return true;
+
+	auto object{ static_cast<unsigned char*>(o) };
+	do
+	{
+		std::string_view key{};
+		if (!reader.readKey(key) || !reader.consume(':')) return false;
+
+		auto field{ plan.find(key) };
+		if (nullptr == field)
+		{
+			if (!reader.skipValue()) return false;
+			continue;
+		}
+
+		auto member{ object + field->offset };
+		auto read{ visitField(*field, [&](auto* type)
+			{
+				using M = std::remove_pointer_t<decltype(type)>;
+				if constexpr (std::is_void_v<M>) return field->info->readJson(member, reader);
+				else return JsonCodec<M>::read(reader, *reinterpret_cast<M*>(member));
+			}) };
+		if (!read) return false;
+	}
+	while (reader.consume(','));
+	return reader.consume('}');
+}
@@ -0,0 +1,589 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "RTTRInfo/RTTRInfo.h"
+
+namespace RTTR
+{
+	/// <summary>
+	/// JSON壬clear()ڶα֮临
+	/// </summary>
+	class JsonWriter
+	{
+	public:
+		void append(char c) { m_buffer.push_back(c); }
+		void append(std::string_view text) { m_buffer.append(text); }
+
+		/// <summary>
+		/// дŵַתšбַֽԭ
+		/// </summary>
+		/// <param name="text"></param>
+		void writeString(std::string_view text);
+
+		/// <summary>
+		/// дֵʽֵnull
+		/// </summary>
+		/// <typeparam name="T"></typeparam>
+		/// <param name="value"></param>
+		template<typename T>
+		void writeNumber(T value)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				if (value != value || value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity())
+				{
+					append("null");
+					return;
+				}
+			}
+
+			char text[32];
+			auto result{ std::to_chars(text, text + sizeof(text), value) };
+			m_buffer.append(text, result.ptr);
+		}
+
+		void clear() { m_buffer.clear(); }
+		void reserve(size_t size) { m_buffer.reserve(size); }
+
+		std::string_view view() const { return m_buffer; }
+		const char* data() const { return m_buffer.data(); }
+		size_t size() const { return m_buffer.size(); }
+
+	private:
+		std::string m_buffer{};
+	};
+
+	/// <summary>
+	/// JSON룬ȡʧʱfalse֮Ķȡû
+	/// </summary>
+	class JsonReader
+	{
+	public:
+		explicit JsonReader(std::string_view text) : m_cursor(text.data()), m_end(text.data() + text.size()) {}
+
+	public:
+		/// <summary>
+		/// հ׺鿴һַ
+		/// </summary>
+		/// <returns>ѵĩβʱ0</returns>
+		char peek()
+		{
+			skipWhitespace();
+			return m_cursor < m_end ? *m_cursor : '\0';
+		}
+
+		/// <summary>
+		/// հ׺ȡַָ
+		/// </summary>
+		/// <param name="c"></param>
+		/// <returns>ǸַʱfalseҲƶȡλ</returns>
+		bool consume(char c)
+		{
+			if (peek() != c) return false;
+			++m_cursor;
+			return true;
+		}
+
+		/// <summary>
+		/// ȡַת壬\uת尴UTF-8
+		/// </summary>
+		/// <param name="value"></param>
+		/// <returns></returns>
+		bool readString(std::string& value);
+
+		/// <summary>
+		/// ȡļ
+		/// תʱֱӷеƬΣ뵽ڲ壬һζȡ֮ǰЧ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <returns></returns>
+		bool readKey(std::string_view& key);
+
+		/// <summary>
+		/// ȡֵnullΪNaN
+		/// </summary>
+		/// <typeparam name="T"></typeparam>
+		/// <param name="value"></param>
+		/// <returns>ʽ򳬳TķΧʱfalse</returns>
+		template<typename T>
+		bool readNumber(T& value)
+		{
+			skipWhitespace();
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				if (readLiteral("null"))
+				{
+					value = std::numeric_limits<T>::quiet_NaN();
+					return true;
+				}
+			}
+
+			//from_charsǰ'+'JSONһ
+			auto result{ std::from_chars(m_cursor, m_end, value) };
+			if (result.ec != std::errc{}) return false;
+			m_cursor = result.ptr;
+			return true;
+		}
+
+		bool readBool(bool& value);
+
+		/// <summary>
+		/// һֵںδעļ
+		/// </summary>
+		/// <returns></returns>
+		bool skipValue() { return skipValue(0); }
+
+		/// <summary>
+		/// հ׺ǷѶȫ
+		/// </summary>
+		/// <returns></returns>
+		bool finished() { return peek() == '\0' && m_cursor == m_end; }
+
+	private:
+		static constexpr size_t MaxDepth{ 512 };
+
+	private:
+		void skipWhitespace()
+		{
+			while (m_cursor < m_end && (*m_cursor == ' ' || *m_cursor == '\n' || *m_cursor == '\r' || *m_cursor == '\t')) ++m_cursor;
+		}
+
+		bool readLiteral(std::string_view literal);
+		bool decodeString(std::string& value);
+		bool skipValue(size_t depth);
+
+	private:
+		const char* m_cursor;
+		const char* m_end;
+		std::string m_key{};
+	};
+
+	/// <summary>
+	/// JSONƻ
+	/// ÿͨԱԤתõļǰ'{'','':'ñֱӰƫƶд;Ϣ
+	/// ʱϣһζλԱ
+	/// </summary>
+	struct JsonPlan
+	{
+	public:
+		enum class Kind : uint8_t
+		{
+			Object,			//info->writeJson/readJson
+			Bool,
+			Int32,
+			UInt32,
+			Int64,
+			UInt64,
+			Float,
+			Double,
+			String,
+		};
+
+		struct Field
+		{
+		public:
+			std::string prefix;			// {"m_id":  ,"m_id":
+			std::string_view name;
+			int offset;
+			Kind kind;
+			const RTTRInfo* info;
+		};
+
+	public:
+		/// <summary>
+		/// ϢƻԱע˳
+		/// </summary>
+		/// <param name="info"></param>
+		/// <returns></returns>
+		static JsonPlan build(const RTTRInfo& info);
+
+	public:
+		/// <summary>
+		/// ҳԱ
+		/// </summary>
+		/// <param name="name"></param>
+		/// <returns>Ҳʱnullptr</returns>
+		const Field* find(std::string_view name) const
+		{
+			if (m_slots.empty()) return nullptr;
+
+			auto slot{ m_slots[hash(name, m_seed) & (m_slots.size() - 1)] };
+			if (0 == slot) return nullptr;
+
+			const auto& field{ fields[slot - 1] };
+			return field.name == name ? &field : nullptr;
+		}
+
+	public:
+		std::vector<Field> fields{};
+
+	private:
+		static uint64_t hash(std::string_view name, uint64_t seed)
+		{
+			uint64_t hash{ 14695981039346656037ull ^ seed };
+			for (auto c : name) hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+			return hash ^ (hash >> 29);
+		}
+
+	private:
+		std::vector<uint16_t> m_slots{};		//Ա±+10ΪգÿԱļڲͬĲ
+		uint64_t m_seed{ 0 };
+	};
+
+	/// <summary>
+	/// ƻѶΪJSON
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o"></param>
+	/// <param name="writer"></param>
+	void writeJsonMembers(const RTTRInfo& info, const void* o, JsonWriter& writer);
+
+	/// <summary>
+	/// ıƻ룬ͬͶʱظȡƻ
+	/// </summary>
+	/// <param name="plan"></param>
+	/// <param name="o"></param>
+	/// <param name="writer"></param>
+	void writeJsonMembers(const JsonPlan& plan, const void* o, JsonWriter& writer);
+
+	/// <summary>
+	/// ƻJSONδעļԣȱٵļԭֵ
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o">ѹĶ</param>
+	/// <param name="reader"></param>
+	/// <returns>ʽʱfalse</returns>
+	bool readJsonMembers(const RTTRInfo& info, void* o, JsonReader& reader);
+
+	/// <summary>
+	/// ıƻ
+	/// </summary>
+	/// <param name="plan"></param>
+	/// <param name="o">ѹĶ</param>
+	/// <param name="reader"></param>
+	/// <returns>ʽʱfalse</returns>
+	bool readJsonMembers(const JsonPlan& plan, void* o, JsonReader& reader);
+
+	/// <summary>
+	/// TJSON
+	/// öٱΪֵͰעͨԱΪ󣻱׼·ػ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	struct JsonCodec
+	{
+	public:
+		static constexpr bool leaf{ std::is_arithmetic_v<T> || std::is_enum_v<T> };
+
+		/// <summary>
+		/// Ҷ͵ıƻ
+		/// </summary>
+		/// <returns></returns>
+		static const JsonPlan& plan() { return RealRTTRInfo<T>::instance()->template plan<JsonPlan>(&JsonPlan::build); }
+
+	public:
+		static void write(JsonWriter& writer, const T& value)
+		{
+			if constexpr (std::is_same_v<T, bool>) writer.append(value ? "true" : "false");
+			else if constexpr (std::is_enum_v<T>) writer.writeNumber(static_cast<std::underlying_type_t<T>>(value));
+			else if constexpr (leaf) writer.writeNumber(value);
+			else writeJsonMembers(plan(), &value, writer);
+		}
+
+		static bool read(JsonReader& reader, T& value)
+		{
+			if constexpr (std::is_same_v<T, bool>) return reader.readBool(value);
+			else if constexpr (std::is_enum_v<T>)
+			{
+				std::underlying_type_t<T> underlying{};
+				if (!reader.readNumber(underlying)) return false;
+				value = static_cast<T>(underlying);
+				return true;
+			}
+			else if constexpr (leaf) return reader.readNumber(value);
+			else return readJsonMembers(plan(), &value, reader);
+		}
+	};
+
+	template<>
+	struct JsonCodec<std::string>
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+	public:
+		static void write(JsonWriter& writer, const std::string& value) { writer.writeString(value); }
+		static bool read(JsonReader& reader, std::string& value) { return reader.readString(value); }
+	};
+
+	/// <summary>
+	/// ΪJSON
+	/// </summary>
+	template<typename C>
+	static void writeJsonArray(JsonWriter& writer, const C& value)
+	{
+		using E = std::remove_cvref_t<decltype(*std::begin(value))>;
+
+		writer.append('[');
+		bool first{ true };
+		for (const auto& element : value)
+		{
+			if (!first) writer.append(',');
+			first = false;
+			JsonCodec<E>::write(writer, element);
+		}
+		writer.append(']');
+	}
+
+	/// <summary>
+	/// ȡJSONԪ
+	/// </summary>
+	/// <param name="reader"></param>
+	/// <param name="element">ȡһԪأǷɹ</param>
+	/// <returns></returns>
+	template<typename Element>
+	static bool readJsonArray(JsonReader& reader, Element element)
+	{
+		if (!reader.consume('[')) return false;
+		if (reader.consume(']')) return true;
+
+		do
+		{
+			if (!element()) return false;
+		}
+		while (reader.consume(','));
+		return reader.consume(']');
+	}
+
+	/// <summary>
+	/// ˳뼯ϣΪ
+	/// </summary>
+	template<typename C>
+	struct JsonSequenceCodec
+	{
+	public:
+		using E = typename C::value_type;
+
+		static constexpr bool leaf{ true };
+
+	public:
+		static void write(JsonWriter& writer, const C& value) { writeJsonArray(writer, value); }
+
+		static bool read(JsonReader& reader, C& value)
+		{
+			value.clear();
+			return readJsonArray(reader, [&reader, &value]
+				{
+					E element{};
+					if (!JsonCodec<E>::read(reader, element)) return false;
+					value.insert(value.end(), std::move(element));
+					return true;
+				});
+		}
+	};
+
+	/// <summary>
+	/// ΪַʱΪ󣬷Ϊ[,ֵ]
+	/// </summary>
+	template<typename C>
+	struct JsonAssociativeCodec
+	{
+	public:
+		using K = std::remove_const_t<typename C::value_type::first_type>;
+		using V = typename C::value_type::second_type;
+
+		static constexpr bool leaf{ true };
+		static constexpr bool object{ std::is_same_v<K, std::string> };
+
+	public:
+		static void write(JsonWriter& writer, const C& value)
+		{
+			if constexpr (!object)
+			{
+				writer.append('[');
+				bool first{ true };
+				for (const auto& [key, mapped] : value)
+				{
+					writer.append(first ? "[" : ",[");
+					first = false;
+					JsonCodec<K>::write(writer, key);
+					writer.append(',');
+					JsonCodec<V>::write(writer, mapped);
+					writer.append(']');
+				}
+				writer.append(']');
+			}
+			else
+			{
+				writer.append('{');
+				bool first{ true };
+				for (const auto& [key, mapped] : value)
+				{
+					if (!first) writer.append(',');
+					first = false;
+					writer.writeString(key);
+					writer.append(':');
+					JsonCodec<V>::write(writer, mapped);
+				}
+				writer.append('}');
+			}
+		}
+
+		static bool read(JsonReader& reader, C& value)
+		{
+			value.clear();
+			if constexpr (!object)
+			{
+				return readJsonArray(reader, [&reader, &value]
+					{
+						std::pair<K, V> element{};
+						if (!reader.consume('[') || !JsonCodec<K>::read(reader, element.first) || !reader.consume(',') || !JsonCodec<V>::read(reader, element.second) || !reader.consume(']')) return false;
+						value.insert(std::move(element));
+						return true;
+					});
+			}
+			else
+			{
+				if (!reader.consume('{')) return false;
+				if (reader.consume('}')) return true;
+
+				do
+				{
+					std::pair<K, V> element{};
+					if (!reader.readString(element.first) || !reader.consume(':') || !JsonCodec<V>::read(reader, element.second)) return false;
+					value.insert(std::move(element));
+				}
+				while (reader.consume(','));
+				return reader.consume('}');
+			}
+		}
+	};
+
+	template<typename E, typename A>
+	struct JsonCodec<std::vector<E, A>> : JsonSequenceCodec<std::vector<E, A>> {};
+
+	template<typename E, typename A>
+	struct JsonCodec<std::deque<E, A>> : JsonSequenceCodec<std::deque<E, A>> {};
+
+	template<typename E, typename A>
+	struct JsonCodec<std::list<E, A>> : JsonSequenceCodec<std::list<E, A>> {};
+
+	template<typename E, typename P, typename A>
+	struct JsonCodec<std::set<E, P, A>> : JsonSequenceCodec<std::set<E, P, A>> {};
+
+	template<typename E, typename H, typename P, typename A>
+	struct JsonCodec<std::unordered_set<E, H, P, A>> : JsonSequenceCodec<std::unordered_set<E, H, P, A>> {};
+
+	template<typename K, typename V, typename P, typename A>
+	struct JsonCodec<std::map<K, V, P, A>> : JsonAssociativeCodec<std::map<K, V, P, A>> {};
+
+	template<typename K, typename V, typename H, typename P, typename A>
+	struct JsonCodec<std::unordered_map<K, V, H, P, A>> : JsonAssociativeCodec<std::unordered_map<K, V, H, P, A>> {};
+
+	template<typename E, size_t N>
+	struct JsonCodec<std::array<E, N>>
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+	public:
+		static void write(JsonWriter& writer, const std::array<E, N>& value) { writeJsonArray(writer, value); }
+
+		static bool read(JsonReader& reader, std::array<E, N>& value)
+		{
+			size_t index{ 0 };
+			return readJsonArray(reader, [&reader, &value, &index] { return index < N && JsonCodec<E>::read(reader, value[index++]); }) && index == N;
+		}
+	};
+
+	template<typename F, typename S>
+	struct JsonCodec<std::pair<F, S>>
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+	public:
+		static void write(JsonWriter& writer, const std::pair<F, S>& value)
+		{
+			writer.append('[');
+			JsonCodec<F>::write(writer, value.first);
+			writer.append(',');
+			JsonCodec<S>::write(writer, value.second);
+			writer.append(']');
+		}
+
+		static bool read(JsonReader& reader, std::pair<F, S>& value)
+		{
+			return reader.consume('[') && JsonCodec<F>::read(reader, value.first) && reader.consume(',') && JsonCodec<S>::read(reader, value.second) && reader.consume(']');
+		}
+	};
+
+	/// <summary>
+	/// RealRTTRInfo<T>::writeJsonʵ֣Ҷֱӱ룬Ͱƻ
+	/// </summary>
+	template<typename T>
+	static void writeJsonObject(const RTTRInfo& info, const void* o, JsonWriter& writer)
+	{
+		if constexpr (std::is_void_v<T>) writer.append("null");
+		else if constexpr (JsonCodec<T>::leaf) JsonCodec<T>::write(writer, *static_cast<const T*>(o));
+		else writeJsonMembers(info, o, writer);
+	}
+
+	/// <summary>
+	/// RealRTTRInfo<T>::readJsonʵ
+	/// </summary>
+	template<typename T>
+	static bool readJsonObject(const RTTRInfo& info, void* o, JsonReader& reader)
+	{
+		if constexpr (std::is_void_v<T>) return reader.skipValue();
+		else if constexpr (JsonCodec<T>::leaf) return JsonCodec<T>::read(reader, *static_cast<T*>(o));
+		else return readJsonMembers(info, o, reader);
+	}
+
+	/// <summary>
+	/// ΪJSON
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="value"></param>
+	/// <param name="writer"></param>
+	template<typename T>
+	static void toJson(const T& value, JsonWriter& writer) { JsonCodec<T>::write(writer, value); }
+
+	/// <summary>
+	/// JSON뵽ѹĶ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="value"></param>
+	/// <param name="reader"></param>
+	/// <returns>ʽʱfalseʱvalueڲд״̬</returns>
+	template<typename T>
+	static bool fromJson(T& value, JsonReader& reader) { return JsonCodec<T>::read(reader, value); }
+
+	/// <summary>
+	/// JSONı룬ıĩβж
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="value"></param>
+	/// <param name="text"></param>
+	/// <returns></returns>
+	template<typename T>
+	static bool fromJson(T& value, std::string_view text)
+	{
+		JsonReader reader{ text };
+		return JsonCodec<T>::read(reader, value) && reader.finished();
+	}
+}
@@ -0,0 +1,147 @@
+#include <assert.h>
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+#include "RTTRPool.hpp"
+
+RTTR::Pool::Pool(size_t size, size_t alignment, size_t objectsPerChunk) :
+	m_alignment(std::max(alignment, alignof(Node))),
+	m_stride((std::max(size, sizeof(Node)) + m_alignment - 1) / m_alignment * m_alignment),
+	m_objectsPerChunk(objectsPerChunk),
+	m_index(s_pools.fetch_add(1))
+{
+	assert(alignment && (alignment & (alignment - 1)) == 0 && objectsPerChunk);
+}
+
+RTTR::Pool::~Pool()
+{
+	assert(m_used.load(std::memory_order_relaxed) == 0);
+
+	//ǰ̻߳еĶǶڼͷŵĿ
+	if (auto cache{ this->cache() }) *cache = {};
+	for (auto chunk : m_chunks) ::operator delete(chunk, std::align_val_t{ m_alignment });
+}
+
+void* RTTR::Pool::allocate()
+{
+	m_used.fetch_add(1, std::memory_order_relaxed);
+
+	auto cache{ this->cache() };
+	if (nullptr == cache)
+	{
+		Cache local{ this };
+		refill(local);
+		auto node{ local.head };
+		local.head = node->next;
+		drain(local, local.count - 1);
+		return node;
+	}
+
+	if (nullptr == cache->head) refill(*cache);
+	auto node{ cache->head };
+	cache->head = node->next;
+	--cache->count;
+	return node;
+}
+
+void RTTR::Pool::deallocate(void* memory)
+{
+	if (nullptr == memory) return;
+
+	assert(m_used.load(std::memory_order_relaxed) > 0);
+	m_used.fetch_sub(1, std::memory_order_relaxed);
+
+	auto cache{ this->cache() };
+	if (nullptr == cache)
+	{
+		Cache local{ this, new (memory) Node{ nullptr }, 1 };
+		drain(local, 1);
+		return;
+	}
+
+	cache->head = new (memory) Node{ cache->head };
+	if (++cache->count > Batch * 2) drain(*cache, Batch);
+}
+
+size_t RTTR::Pool::reserved() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_reserved;
+}
+
+RTTR::Pool::Cache* RTTR::Pool::cache()
+{
+	//̵߳ĻǷƽֲ߳̾ʱԿɶȡ
+	thread_local bool t_exited{ false };
+	if (t_exited) return nullptr;
+
+	//߳˳ʱѻĶ󻹸ԵĶ
+	struct ThreadCaches
+	{
+	public:
+		~ThreadCaches()
+		{
+			t_exited = true;
+			for (auto& cache : caches)
+				if (cache.pool && cache.count) cache.pool->drain(cache, cache.count);
+		}
+
+	public:
+		std::vector<Cache> caches{};
+	};
+	thread_local ThreadCaches t_caches{};
+
+	if (m_index >= t_caches.caches.size()) t_caches.caches.resize(m_index + 1);
+
+	auto& cache{ t_caches.caches[m_index] };
+	cache.pool = this;
+	return &cache;
+}
+
+void RTTR::Pool::refill(Cache& cache)
+{
+	std::lock_guard lock{ m_mutex };
+	while (m_free && cache.count < Batch)
+	{
+		auto node{ m_free };
+		m_free = node->next;
+		node->next = cache.head;
+		cache.head = node;
+		++cache.count;
+	}
+	if (cache.count) return;
+
+	if (0 == m_remaining)
+	{
+		auto chunkSize{ m_stride * m_objectsPerChunk };
+		m_cursor = static_cast<unsigned char*>(::operator new(chunkSize, std::align_val_t{ m_alignment }));
+		m_chunks.push_back(m_cursor);
+		m_remaining = m_objectsPerChunk;
+		m_reserved += chunkSize;
+	}
+
+	//ӵǰгһַ뻺
+	auto count{ std::min(Batch, m_remaining) };
+	for (size_t i = count; i-- > 0;) cache.head = new (m_cursor + i * m_stride) Node{ cache.head };
+	cache.count += count;
+	m_cursor += count * m_stride;
+	m_remaining -= count;
+}
+
+void RTTR::Pool::drain(Cache& cache, size_t count)
+{
+	if (0 == count) return;
+
+	//ҵһεĩβνӵ
+	auto first{ cache.head };
+	auto last{ first };
+	for (size_t i = 1; i < count; ++i) last = last->next;
+	cache.head = last->next;
+	cache.count -= count;
+
+	std::lock_guard lock{ m_mutex };
+	last->next = m_free;
+	m_free = first;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace RTTR
+{
+	/// <summary>
+	/// 
+	/// ϵͳ洢ÿɹ̶Ķ󣬿ڶʱ黹
+	/// ǰжѹ黹̲߳ʹøöأעᵽϢĶͬ
+	/// ÿ߳һС棬黹ͨ˻ѹʱ빲Ŀ
+	/// </summary>
+	class Pool
+	{
+	public:
+		/// <summary>
+		/// </summary>
+		/// <param name="size">С</param>
+		/// <param name="alignment">룬Ϊ2</param>
+		/// <param name="objectsPerChunk">ÿĶ</param>
+		Pool(size_t size, size_t alignment, size_t objectsPerChunk);
+		Pool(const Pool&) = delete;
+		Pool& operator =(const Pool&) = delete;
+		~Pool();
+
+	public:
+		/// <summary>
+		/// һδʼ洢
+		/// </summary>
+		/// <returns></returns>
+		void* allocate();
+
+		/// <summary>
+		/// 黹allocate()Ĵ洢̹߳黹
+		/// </summary>
+		/// <param name="memory"></param>
+		void deallocate(void* memory);
+
+		/// <summary>
+		/// ÿռõֽܷ¿ָ
+		/// </summary>
+		/// <returns></returns>
+		size_t stride() const { return m_stride; }
+
+		/// <summary>
+		/// ϵͳֽ
+		/// </summary>
+		/// <returns></returns>
+		size_t reserved() const;
+
+		/// <summary>
+		/// δ黹Ķ
+		/// </summary>
+		/// <returns></returns>
+		size_t used() const { return m_used.load(std::memory_order_relaxed); }
+
+	private:
+		/// <summary>
+		/// ̻߳빲֮ÿνĶ
+		/// </summary>
+		static constexpr size_t Batch{ 32 };
+
+		struct Node
+		{
+		public:
+			Node* next;
+		};
+
+		struct Cache
+		{
+		public:
+			Pool* pool{ nullptr };
+			Node* head{ nullptr };
+			size_t count{ 0 };
+		};
+
+	private:
+		/// <summary>
+		/// ǰ̶߳ԱصĻ
+		/// </summary>
+		/// <returns>߳˳ʱnullptr</returns>
+		Cache* cache();
+
+		/// <summary>
+		/// ӹǰȡһ뻺
+		/// </summary>
+		/// <param name="cache"></param>
+		void refill(Cache& cache);
+
+		/// <summary>
+		/// ѻеcount󻹸
+		/// </summary>
+		/// <param name="cache"></param>
+		/// <param name="count"></param>
+		void drain(Cache& cache, size_t count);
+
+	private:
+		static inline std::atomic<size_t> s_pools{ 0 };
+
+	private:
+		const size_t m_alignment;
+		const size_t m_stride;
+		const size_t m_objectsPerChunk;
+		const size_t m_index;					//̻߳е±
+
+		mutable std::mutex m_mutex{};
+		Node* m_free{ nullptr };				//ѹ黹Ķ
+		unsigned char* m_cursor{ nullptr };		//ǰδĲ
+		size_t m_remaining{ 0 };				//ǰδĶ
+		size_t m_reserved{ 0 };
+		std::vector<unsigned char*> m_chunks{};	//Ŀ
+		std::atomic<size_t> m_used{ 0 };
+	};
+}
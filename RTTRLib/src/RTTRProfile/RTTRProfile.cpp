@@ -0,0 +1,449 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "RTTRProfile.hpp"
+#include "RTTRInfo/RTTRInfo.h"
+#include "RTTRJson/RTTRJson.hpp"
+
+namespace
+{
+	using namespace RTTR::Profile;
+
+	/// <summary>
+	/// ļΪMethodInfoĵַʧΪ͵ĵַλ0Ϊ
+	/// </summary>
+	using Key = uintptr_t;
+
+	/// <summary>
+	/// ϲļ
+	/// </summary>
+	struct Totals
+	{
+		uint64_t calls{ 0 };
+		uint64_t sampled{ 0 };
+		uint64_t totalNs{ 0 };
+		uint64_t histogram[Buckets]{};
+
+		void subtract(const Totals& other)
+		{
+			calls -= other.calls;
+			sampled -= other.sampled;
+			totalNs -= other.totalNs;
+			for (size_t i = 0; i < Buckets; ++i) histogram[i] -= other.histogram[i];
+		}
+	};
+
+	using TotalsMap = std::unordered_map<Key, Totals>;
+
+	/// <summary>
+	/// Ŀɶ֣::(, ...)
+	/// </summary>
+	std::string describe(const RTTR::MethodInfo& method)
+	{
+		std::string text{ method.owner ? method.owner->name() : "?" };
+		text.append("::").append(method.name).push_back('(');
+		for (size_t i = 0; i < method.args.size(); ++i)
+		{
+			if (i) text.append(", ");
+			text.append(method.args[i]->name());
+		}
+		text.push_back(')');
+		return text;
+	}
+}
+
+#if RTTR_INSTRUMENTATION
+namespace
+{
+	Key methodKey(const RTTR::MethodInfo* method) { return reinterpret_cast<Key>(method); }
+	Key missKey(const RTTR::RTTRInfo* info) { return reinterpret_cast<Key>(info) | 1; }
+	bool isMiss(Key key) { return key & 1; }
+
+	void accumulate(const Counter& counter, Totals& totals)
+	{
+		totals.calls += counter.calls.load(std::memory_order_relaxed);
+		totals.sampled += counter.sampled.load(std::memory_order_relaxed);
+		totals.totalNs += counter.totalNs.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < Buckets; ++i) totals.histogram[i] += counter.histogram[i].load(std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// ʱڵֱͼͰ
+	/// </summary>
+	size_t bucketOf(uint64_t ns) { return std::min<size_t>(std::bit_width(ns), Buckets - 1); }
+
+	class ThreadCounters;
+
+	/// <summary>
+	/// ̵߳ļϲʱ·ϲ
+	/// </summary>
+	class Registry
+	{
+	public:
+		static Registry& instance()
+		{
+			//˳ʱеܻ߳̿ע
+			static Registry* s_instance{ new Registry{} };
+			return *s_instance;
+		}
+
+	public:
+		void attach(ThreadCounters* counters);
+		void detach(ThreadCounters* counters);
+
+		/// <summary>
+		/// ϲ߳(˳߳)ļ
+		/// </summary>
+		TotalsMap collect();
+
+		std::mutex& mutex() { return m_mutex; }
+		TotalsMap& baseline() { return m_baseline; }
+
+	private:
+		std::mutex m_mutex{};
+		std::vector<ThreadCounters*> m_threads{};
+		TotalsMap m_retired{};
+		TotalsMap m_baseline{};
+	};
+
+	/// <summary>
+	/// ߳˽еļ
+	/// ֿҲƶָreleaseϲ̲߳̿߳ȡ
+	/// </summary>
+	class ThreadCounters
+	{
+	public:
+		static constexpr size_t BlockSize{ 64 };
+		static constexpr size_t MaxBlocks{ 1024 };
+
+	public:
+		ThreadCounters() { Registry::instance().attach(this); }
+
+		~ThreadCounters()
+		{
+			Registry::instance().detach(this);
+			for (auto& block : m_blocks) delete[] block.load(std::memory_order_relaxed);
+		}
+
+		ThreadCounters(const ThreadCounters&) = delete;
+		ThreadCounters& operator =(const ThreadCounters&) = delete;
+
+	public:
+		static ThreadCounters& current()
+		{
+			//ָƽͣʱֲ߳̾ĳʼ
+			thread_local ThreadCounters* t_current{ nullptr };
+			if (t_current == nullptr) [[unlikely]]
+			{
+				thread_local ThreadCounters t_counters{};
+				t_current = &t_counters;
+			}
+			return *t_current;
+		}
+
+		/// <summary>
+		/// һ򴴽Ӧļ
+		/// </summary>
+		Counter* counter(Key key)
+		{
+			if (m_index.empty()) m_index.resize(64);
+
+			auto mask{ m_index.size() - 1 };
+			for (auto i{ hash(key) & mask };; i = (i + 1) & mask)
+			{
+				auto& slot{ m_index[i] };
+				if (slot.first == key) return slot.second;
+				if (slot.second == nullptr) return insert(key);
+			}
+		}
+
+		/// <summary>
+		/// Ѽۼӵtotals̵߳
+		/// </summary>
+		void addTo(TotalsMap& totals) const
+		{
+			auto count{ m_count.load(std::memory_order_acquire) };
+			for (size_t i = 0; i < count; ++i)
+			{
+				const auto& counter{ m_blocks[i / BlockSize].load(std::memory_order_acquire)[i % BlockSize] };
+				accumulate(counter, totals[counter.key]);
+			}
+		}
+
+	private:
+		static size_t hash(Key key) { return static_cast<size_t>((key >> 3) * 0x9E3779B97F4A7C15ull >> 16); }
+
+		Counter* insert(Key key)
+		{
+			auto count{ m_count.load(std::memory_order_relaxed) };
+			if (count == BlockSize * MaxBlocks) return &m_overflow;
+
+			auto& block{ m_blocks[count / BlockSize] };
+			if (count % BlockSize == 0) block.store(new Counter[BlockSize], std::memory_order_release);
+
+			auto counter{ &block.load(std::memory_order_relaxed)[count % BlockSize] };
+			counter->key = key;
+			m_count.store(count + 1, std::memory_order_release);
+
+			//سһʱؽ
+			if ((count + 1) * 2 > m_index.size())
+			{
+				std::vector<std::pair<Key, Counter*>> index(m_index.size() * 2);
+				m_index.swap(index);
+				for (const auto& slot : index) if (slot.second) place(slot.first, slot.second);
+			}
+			place(key, counter);
+			return counter;
+		}
+
+		void place(Key key, Counter* counter)
+		{
+			auto mask{ m_index.size() - 1 };
+			auto i{ hash(key) & mask };
+			while (m_index[i].second) i = (i + 1) & mask;
+			m_index[i] = { key, counter };
+		}
+
+	private:
+		std::vector<std::pair<Key, Counter*>> m_index{};		//̷ֻ߳
+		std::atomic<Counter*> m_blocks[MaxBlocks]{};
+		std::atomic<size_t> m_count{ 0 };
+		Counter m_overflow{};								//ļٵͳ
+	};
+
+	void Registry::attach(ThreadCounters* counters)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_threads.push_back(counters);
+	}
+
+	void Registry::detach(ThreadCounters* counters)
+	{
+		std::lock_guard lock{ m_mutex };
+		counters->addTo(m_retired);
+		std::erase(m_threads, counters);
+	}
+
+	TotalsMap Registry::collect()
+	{
+		TotalsMap totals{ m_retired };
+		for (auto counters : m_threads) counters->addTo(totals);
+		return totals;
+	}
+}
+
+RTTR::Profile::Counter* RTTR::Profile::methodCounter(const MethodInfo& method)
+{
+	auto counter{ ThreadCounters::current().counter(methodKey(&method)) };
+	t_recent = { &method, counter };
+	return counter;
+}
+
+int64_t RTTR::Profile::Scope::now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RTTR::Profile::Scope::record()
+{
+	auto ns{ static_cast<uint64_t>(std::max<int64_t>(now() - m_begin, 0)) };
+	Counter::bump(m_counter->sampled, 1);
+	Counter::bump(m_counter->totalNs, ns);
+	Counter::bump(m_counter->histogram[bucketOf(ns)], 1);
+}
+
+void RTTR::Profile::recordMiss(const RTTRInfo* info)
+{
+	Counter::bump(ThreadCounters::current().counter(missKey(info))->calls, 1);
+}
+#endif
+
+uint64_t RTTR::Profile::MethodStats::percentileNs(double quantile) const
+{
+	uint64_t total{ 0 };
+	for (auto count : histogram) total += count;
+	if (total == 0) return 0;
+
+	auto target{ std::max<uint64_t>(1, static_cast<uint64_t>(quantile * total + 0.5)) };
+	uint64_t seen{ 0 };
+	for (size_t i = 0; i < Buckets; ++i)
+	{
+		seen += histogram[i];
+		if (seen >= target) return uint64_t{ 1 } << i;
+	}
+	return uint64_t{ 1 } << (Buckets - 1);
+}
+
+const RTTR::Profile::MethodStats* RTTR::Profile::Snapshot::find(const MethodInfo* method) const
+{
+	auto it{ std::find_if(methods.begin(), methods.end(), [method](const auto& stats) { return stats.method == method; }) };
+	return it == methods.end() ? nullptr : &*it;
+}
+
+const RTTR::Profile::TypeStats* RTTR::Profile::Snapshot::find(const RTTRInfo* info) const
+{
+	auto it{ std::find_if(types.begin(), types.end(), [info](const auto& stats) { return stats.info == info; }) };
+	return it == types.end() ? nullptr : &*it;
+}
+
+std::string RTTR::Profile::Snapshot::toText() const
+{
+	std::string text{};
+	char line[256];
+
+	std::snprintf(line, sizeof(line), "%12s %10s %10s %10s %10s  %s\n", "calls", "sampled", "mean ns", "p50 ns", "p99 ns", "method");
+	text.append(line);
+	for (const auto& stats : methods)
+	{
+		std::snprintf(line, sizeof(line), "%12llu %10llu %10.1f %10llu %10llu  ",
+			static_cast<unsigned long long>(stats.calls), static_cast<unsigned long long>(stats.sampled), stats.meanNs(),
+			static_cast<unsigned long long>(stats.percentileNs(0.5)), static_cast<unsigned long long>(stats.percentileNs(0.99)));
+		text.append(line).append(describe(*stats.method)).push_back('\n');
+	}
+
+	std::snprintf(line, sizeof(line), "\n%12s %10s %10s %10s  %s\n", "calls", "sampled", "mean ns", "misses", "type");
+	text.append(line);
+	for (const auto& stats : types)
+	{
+		std::snprintf(line, sizeof(line), "%12llu %10llu %10.1f %10llu  ",
+			static_cast<unsigned long long>(stats.calls), static_cast<unsigned long long>(stats.sampled),
+			stats.sampled ? static_cast<double>(stats.totalNs) / stats.sampled : 0.0, static_cast<unsigned long long>(stats.misses));
+		text.append(line).append(stats.info ? stats.info->name() : "(unknown type)").push_back('\n');
+	}
+
+	std::snprintf(line, sizeof(line), "\nmisses: %llu\n", static_cast<unsigned long long>(misses));
+	text.append(line);
+	return text;
+}
+
+std::string RTTR::Profile::Snapshot::toJson() const
+{
+	JsonWriter writer{};
+	writer.append(R"({"misses":)");
+	writer.writeNumber(misses);
+
+	writer.append(R"(,"methods":[)");
+	for (size_t i = 0; i < methods.size(); ++i)
+	{
+		const auto& stats{ methods[i] };
+		if (i) writer.append(',');
+		writer.append(R"({"type":)");
+		writer.writeString(stats.method->owner ? stats.method->owner->name() : std::string_view{});
+		writer.append(R"(,"method":)");
+		writer.writeString(stats.method->name);
+		writer.append(R"(,"signature":)");
+		writer.writeString(describe(*stats.method));
+		writer.append(R"(,"calls":)");
+		writer.writeNumber(stats.calls);
+		writer.append(R"(,"sampled":)");
+		writer.writeNumber(stats.sampled);
+		writer.append(R"(,"meanNs":)");
+		writer.writeNumber(stats.meanNs());
+		writer.append(R"(,"p50Ns":)");
+		writer.writeNumber(stats.percentileNs(0.5));
+		writer.append(R"(,"p99Ns":)");
+		writer.writeNumber(stats.percentileNs(0.99));
+		writer.append(R"(,"histogram":[)");
+		for (size_t bucket = 0; bucket < Buckets; ++bucket)
+		{
+			if (bucket) writer.append(',');
+			writer.writeNumber(stats.histogram[bucket]);
+		}
+		writer.append("]}");
+	}
+
+	writer.append(R"(],"types":[)");
+	for (size_t i = 0; i < types.size(); ++i)
+	{
+		const auto& stats{ types[i] };
+		if (i) writer.append(',');
+		writer.append(R"({"type":)");
+		if (stats.info) writer.writeString(stats.info->name());
+		else writer.append("null");
+		writer.append(R"(,"calls":)");
+		writer.writeNumber(stats.calls);
+		writer.append(R"(,"sampled":)");
+		writer.writeNumber(stats.sampled);
+		writer.append(R"(,"totalNs":)");
+		writer.writeNumber(stats.totalNs);
+		writer.append(R"(,"misses":)");
+		writer.writeNumber(stats.misses);
+		writer.append("}");
+	}
+	writer.append("]}");
+	return std::string{ writer.view() };
+}
+
+RTTR::Profile::Snapshot RTTR::Profile::snapshot()
+{
+	Snapshot snapshot{};
+#if RTTR_INSTRUMENTATION
+	TotalsMap totals{};
+	{
+		auto& registry{ Registry::instance() };
+		std::lock_guard lock{ registry.mutex() };
+		totals = registry.collect();
+		for (const auto& [key, base] : registry.baseline())
+		{
+			if (auto it{ totals.find(key) }; it != totals.end()) it->second.subtract(base);
+		}
+	}
+
+	std::unordered_map<const RTTRInfo*, TypeStats> types{};
+	for (const auto& [key, value] : totals)
+	{
+		if (value.calls == 0 || key == 0) continue;
+		if (isMiss(key))
+		{
+			auto info{ reinterpret_cast<const RTTRInfo*>(key & ~Key{ 1 }) };
+			types[info].info = info;
+			types[info].misses += value.calls;
+			snapshot.misses += value.calls;
+			continue;
+		}
+
+		auto& stats{ snapshot.methods.emplace_back() };
+		stats.method = reinterpret_cast<const MethodInfo*>(key);
+		stats.calls = value.calls;
+		stats.sampled = value.sampled;
+		stats.totalNs = value.totalNs;
+		std::copy(std::begin(value.histogram), std::end(value.histogram), stats.histogram);
+
+		if (auto owner{ stats.method->owner })
+		{
+			auto& type{ types[owner] };
+			type.info = owner;
+			type.calls += value.calls;
+			type.sampled += value.sampled;
+			type.totalNs += value.totalNs;
+		}
+	}
+	for (const auto& [info, stats] : types) snapshot.types.push_back(stats);
+
+	std::sort(snapshot.methods.begin(), snapshot.methods.end(), [](const auto& a, const auto& b) { return a.calls > b.calls; });
+	std::sort(snapshot.types.begin(), snapshot.types.end(), [](const auto& a, const auto& b) { return a.calls + a.misses > b.calls + b.misses; });
+#endif
+	return snapshot;
+}
+
+void RTTR::Profile::reset()
+{
+#if RTTR_INSTRUMENTATION
+	auto& registry{ Registry::instance() };
+	std::lock_guard lock{ registry.mutex() };
+	registry.baseline() = registry.collect();
+#endif
+}
+
+void RTTR::Profile::setSampling([[maybe_unused]] uint32_t everyNth)
+{
+#if RTTR_INSTRUMENTATION
+	s_sampleMask.store(std::bit_ceil(std::max<uint32_t>(everyNth, 1)) - 1, std::memory_order_relaxed);
+#endif
+}
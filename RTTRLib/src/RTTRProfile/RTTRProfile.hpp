@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//ͳƣĬϹرգرʱ·ϲκδ
+//ʹֵ߱ͬ룬CMakeͨRTTR_INSTRUMENTATIONѡͳһ
+#ifndef RTTR_INSTRUMENTATION
+#define RTTR_INSTRUMENTATION 0
+#endif
+
+#if RTTR_INSTRUMENTATION
+//ͳһηãʱ¼ʱ
+#define RTTR_PROFILE_CALL(method) const RTTR::Profile::Scope rttrProfileScope{ method }
+//ͳһΰǩҷʧܣinfoΪҵͣͲʱΪnullptr
+#define RTTR_PROFILE_MISS(info) RTTR::Profile::recordMiss(info)
+#else
+#define RTTR_PROFILE_CALL(method) ((void)0)
+#define RTTR_PROFILE_MISS(info) ((void)0)
+#endif
+
+namespace RTTR
+{
+	class RTTRInfo;
+	struct MethodInfo;
+
+	namespace Profile
+	{
+		/// <summary>
+		/// Ƿͳƴ
+		/// </summary>
+		constexpr bool Enabled{ RTTR_INSTRUMENTATION != 0 };
+
+		/// <summary>
+		/// ʱֱͼͰiͰͳ[2^(i-1), 2^i)ĵãһͰĵ
+		/// </summary>
+		constexpr size_t Buckets{ 24 };
+
+		/// <summary>
+		/// ͳ
+		/// </summary>
+		struct MethodStats
+		{
+		public:
+			/// <summary>
+			/// ʱƽʱ()
+			/// </summary>
+			double meanNs() const { return sampled ? static_cast<double>(totalNs) / sampled : 0.0; }
+
+			/// <summary>
+			/// ֱͼķλʱͰϽ()
+			/// </summary>
+			/// <param name="quantile">01֮</param>
+			uint64_t percentileNs(double quantile) const;
+
+		public:
+			const MethodInfo* method{ nullptr };
+			uint64_t calls{ 0 };
+			uint64_t sampled{ 0 };			//ʱĵôsetSampling
+			uint64_t totalNs{ 0 };			//ʱõܺʱ
+			uint64_t histogram[Buckets]{};
+		};
+
+		/// <summary>
+		/// ͵ͳƣ䷽ͳʧܴ
+		/// </summary>
+		struct TypeStats
+		{
+			const RTTRInfo* info{ nullptr };	//nullptrʾֲʱͲ
+			uint64_t calls{ 0 };
+			uint64_t sampled{ 0 };
+			uint64_t totalNs{ 0 };
+			uint64_t misses{ 0 };
+		};
+
+		/// <summary>
+		/// ĳһʱ̺ϲ̺߳ͳƣ;ô
+		/// </summary>
+		struct Snapshot
+		{
+		public:
+			/// <summary>
+			/// ҷͳ
+			/// </summary>
+			/// <returns>ûеü¼ʱnullptr</returns>
+			const MethodStats* find(const MethodInfo* method) const;
+
+			/// <summary>
+			/// ͵ͳ
+			/// </summary>
+			/// <returns>ûеʧܼ¼ʱnullptr</returns>
+			const TypeStats* find(const RTTRInfo* info) const;
+
+			/// <summary>
+			/// ΪĶı
+			/// </summary>
+			std::string toText() const;
+
+			/// <summary>
+			/// ΪJSON
+			/// </summary>
+			std::string toJson() const;
+
+		public:
+			std::vector<MethodStats> methods{};
+			std::vector<TypeStats> types{};
+			uint64_t misses{ 0 };
+		};
+
+		/// <summary>
+		/// ϲ̵߳ļõϴresetͳ
+		/// ֻ߳дԼļϲʱŶȡ·ûйĻ
+		/// </summary>
+		Snapshot snapshot();
+
+		/// <summary>
+		/// ͳƣ֮snapshotֻ˺ĵ
+		/// </summary>
+		void reset();
+
+		/// <summary>
+		/// üʱÿ߳ÿÿeveryNthεüʱһΣôǾȷ
+		/// </summary>
+		/// <param name="everyNth">ȡΪ2ݣĬ641ʾÿεöʱ</param>
+		void setSampling(uint32_t everyNth);
+
+#if RTTR_INSTRUMENTATION
+		/// <summary>
+		/// ߳һһ͵ļ
+		/// ֻ߳д룬relaxedĶдԭӼӷϲʱֻ߳
+		/// </summary>
+		struct Counter
+		{
+		public:
+			static void bump(std::atomic<uint64_t>& counter, uint64_t value)
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			}
+
+		public:
+			uintptr_t key{ 0 };
+			std::atomic<uint64_t> calls{ 0 };
+			std::atomic<uint64_t> sampled{ 0 };
+			std::atomic<uint64_t> totalNs{ 0 };
+			std::atomic<uint64_t> histogram[Buckets]{};
+		};
+
+		/// <summary>
+		/// ʱ룬ô밴λΪ0ʱʱ
+		/// </summary>
+		inline std::atomic<uint64_t> s_sampleMask{ 63 };
+
+		/// <summary>
+		/// ߳һεõķͬһʱȥ
+		/// </summary>
+		struct RecentCounter
+		{
+			const MethodInfo* method;
+			Counter* counter;
+		};
+		inline thread_local RecentCounter t_recent{};
+
+		/// <summary>
+		/// һ򴴽ǰ߳зļt_recent
+		/// </summary>
+		Counter* methodCounter(const MethodInfo& method);
+
+		/// <summary>
+		/// ͳһηõ
+		/// </summary>
+		class Scope
+		{
+		public:
+			explicit Scope(const MethodInfo& method) :
+				m_counter(t_recent.method == &method ? t_recent.counter : methodCounter(method))
+			{
+				auto calls{ m_counter->calls.load(std::memory_order_relaxed) + 1 };
+				m_counter->calls.store(calls, std::memory_order_relaxed);
+				if ((calls & s_sampleMask.load(std::memory_order_relaxed)) == 0) [[unlikely]] m_begin = now();
+			}
+
+			~Scope() { if (m_begin != 0) [[unlikely]] record(); }
+
+			Scope(const Scope&) = delete;
+			Scope& operator =(const Scope&) = delete;
+
+		private:
+			static int64_t now();
+			void record();
+
+		private:
+			Counter* m_counter;
+			int64_t m_begin{ 0 };		//ʱΪ0
+		};
+
+		/// <summary>
+		/// ¼һΰǩҷʧ
+		/// </summary>
+		void recordMiss(const RTTRInfo* info);
+#endif
+	}
+}
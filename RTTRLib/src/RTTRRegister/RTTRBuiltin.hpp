@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "RTTRRegister.hpp"
+
+//ͣԱ뷽ǩгõͳһע
+RTTR_REGISTER(void)
+RTTR_REGISTER(bool)
+RTTR_REGISTER(char)
+RTTR_REGISTER(signed char)
+RTTR_REGISTER(unsigned char)
+RTTR_REGISTER(short)
+RTTR_REGISTER(unsigned short)
+RTTR_REGISTER(int)
+RTTR_REGISTER(unsigned int)
+RTTR_REGISTER(long)
+RTTR_REGISTER(unsigned long)
+RTTR_REGISTER(long long)
+RTTR_REGISTER(unsigned long long)
+RTTR_REGISTER(float)
+RTTR_REGISTER(double)
+RTTR_REGISTER(std::string)
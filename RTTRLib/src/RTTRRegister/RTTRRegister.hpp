@@ -1,6 +1,10 @@
 #pragma once
 
 #include "RTTRInfo/RTTRInfo.h"
+#include "RTTRJson/RTTRJson.hpp"
+#include "RTTRSerialize/RTTRSerialize.hpp"
+#include "RTTRStatic/RTTRStatic.hpp"
+#include "RTTRValue/RTTRValue.hpp"
 
 //ע
 #define RTTR_REGISTER(T) \
@@ -17,21 +21,101 @@ namespace RTTR \
 		} \
 \
 	public: \
-		std::string name() const override { return typeid(T).name(); } \
-		size_t size() const override { if constexpr (std::is_void_v<T>) return 0; else return sizeof(T); } \
+		static constexpr std::string_view typeName{ #T }; \
+		static constexpr RTTR::TypeId typeId{ RTTR::typeId(typeName) }; \
+\
+	public: \
+		size_t size() const override { return RTTR::sizeOf<T>(); } \
+		size_t alignment() const override { return RTTR::alignmentOf<T>(); } \
+		void destruct(void* o) const override { RTTR::destruct<T>(o); } \
+		bool copyConstruct(void* memory, const void* o) const override { return RTTR::copyConstruct<T>(memory, o); } \
+		bool moveConstruct(void* memory, void* o) const override { return RTTR::moveConstruct<T>(memory, o); } \
+		bool copyAssign(void* o, const void* value) const override { return RTTR::copyAssign<T>(o, value); } \
+		bool moveAssign(void* o, void* value) const override { return RTTR::moveAssign<T>(o, value); } \
+		bool trivial() const override { if constexpr (std::is_void_v<T>) return false; else return std::is_trivially_copyable_v<T>; } \
+		bool bytewise() const override { return RTTR::bytewise<T>(); } \
+		bool equals(const void* lhs, const void* rhs) const override { return RTTR::equalsObject<T>(*this, lhs, rhs); } \
+		size_t hash(const void* o) const override { return RTTR::hashObject<T>(*this, o); } \
+		void serialize(const void* o, RTTR::BinaryWriter& writer) const override { RTTR::serializeObject<T>(*this, o, writer); } \
+		bool deserialize(void* o, RTTR::BinaryReader& reader) const override { return RTTR::deserializeObject<T>(*this, o, reader); } \
+		void writeJson(const void* o, RTTR::JsonWriter& writer) const override { RTTR::writeJsonObject<T>(*this, o, writer); } \
+		bool readJson(void* o, RTTR::JsonReader& reader) const override { return RTTR::readJsonObject<T>(*this, o, reader); } \
 \
 	private: \
-		RealRTTRInfo<T>() : RTTRInfo() { registerRTTRInfo(this); } \
-		~RealRTTRInfo<T>() = default; \
+		RealRTTRInfo() : RTTRInfo(typeId, typeName) { registerRTTRInfo(this); } \
+		~RealRTTRInfo() = default; \
 	}; \
 }
 
-//עḸ
-#define RRTR_REGISTER_SUPERCLASS(Interview, Superclass) \
+namespace RTTR
+{
+	/// <summary>
+	/// ͵ע飬RTTR_REGISTRATION壬ÿִֻһ
+	/// עҪ˽гԱʱRTTR::RegistrationΪԪ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	struct Registration
+	{
+	public:
+		/// <summary>
+		/// ע
+		/// </summary>
+		static void run();
+
+		/// <summary>
+		/// static_info<T>עԱ뷽ִע飬ظòظע
+		/// TִУ͵עе
+		/// </summary>
+		/// <returns></returns>
+		static bool once()
+		{
+			static const bool s_registered{ (RealRTTRInfo<T>::instance()->registerWith([](RTTRInfo&) { registerStaticInfo<T>(); run(); }), true) };
+			return s_registered;
+		}
+	};
+}
+
+#define RTTR_CONCAT_IMPL(A, B) A##B
+#define RTTR_CONCAT(A, B) RTTR_CONCAT_IMPL(A, B)
+
+//͵ע飬̬ʼʱֻǼע飬һβѯ͵ĳԱ캯ʱִһ
+//ֲͲע飬ӲͲԱҪִʱRTTR::Registration<T>::once()
+//÷: RTTR_REGISTRATION(T) { RTTR_REGISTER_NORMAL_MEMBER(T, RTTR::Public, m_value); ... }
+#define RTTR_REGISTRATION(T) \
+template<> void RTTR::Registration<T>::run(); \
+static const bool RTTR_CONCAT(s_rttrRegistration, __LINE__){ RTTR::RealRTTRInfo<T>::instance()->registerLazy([](RTTR::RTTRInfo&) { RTTR::Registration<T>::once(); }) }; \
+template<> void RTTR::Registration<T>::run()
+
+//עḸ࣬ͬʱ¼ָisA/upcast/downcast̳вʹ
+#define RRTR_REGISTER_SUPERCLASS(T, Interview, Superclass) \
+do \
+{ \
+	RTTR::RealRTTRInfo<T>::instance()->registerSuperclass({ Interview, RTTR::RealRTTRInfo<Superclass>::instance(), RTTR::superclassOffset<T, Superclass>() }); \
+} \
+while (false)
+
+//עṹ캯бΪʱעĬϹ캯
+#define RTTR_REGISTER_CONSTRUCTOR(T, Interview, ...) \
+do \
+{ \
+	RTTR::RealRTTRInfo<T>::instance()->registerConstructor(RTTR::ConstructorInfo::of<__VA_ARGS__>(Interview, std::type_identity<T>{})); \
+} \
+while (false)
+
+//Ϊöأcreate()/destroy()پͨö
+#define RTTR_REGISTER_POOL(T, ObjectsPerChunk) \
+do \
+{ \
+	RTTR::RealRTTRInfo<T>::instance()->registerPool(ObjectsPerChunk); \
+} \
+while (false)
+
+//Ϊñ٣NameΪRTTR::DirtyBitsԱעͨԱ֮ǰ
+#define RTTR_REGISTER_DIRTY_BITS(T, Name) \
 do \
 { \
-	using T = decltype(*this); \
-	RTTR::RealRTTRInfo<T>::instance()->registerSuperclass({ Interview, RTTR::RealRTTRInfo<Superclass>::instance() }); \
+	RTTR::RealRTTRInfo<T>::instance()->registerDirtyBits(RTTR::memberOffset<&T::Name>(), decltype(T::Name)::Capacity); \
 } \
 while (false)
 
@@ -39,17 +123,17 @@ while (false)
 #define RTTR_REGISTER_STATIC_MEMBER(T, Interview, Name) \
 do \
 { \
+	static_assert(!RTTR::hasStaticInfo<T>, "T declares RTTR::static_info, its members and methods are registered from it"); \
 	RTTR::RealRTTRInfo<T>::instance()->registerStaticMember({ #Name, Interview, RTTR::RealRTTRInfo<decltype(T::Name)>::instance(), &T::Name }); \
 } \
 while (false)
 
 //עͨԱ
-#define RTTR_REGISTER_NORMAL_MEMBER(Interview, Name) \
+#define RTTR_REGISTER_NORMAL_MEMBER(T, Interview, Name) \
 do \
 { \
-	using T = std::remove_const_t<std::remove_reference_t<decltype(*this)>>; \
-	auto offset{ &T::Name }; \
-	RTTR::RealRTTRInfo<T>::instance()->registerNormalMember({ #Name, Interview, RTTR::RealRTTRInfo<decltype(T::Name)>::instance(), *(int*)(&offset) }); \
+	static_assert(!RTTR::hasStaticInfo<T>, "T declares RTTR::static_info, its members and methods are registered from it"); \
+	RTTR::RealRTTRInfo<T>::instance()->registerNormalMember({ #Name, Interview, RTTR::RealRTTRInfo<decltype(T::Name)>::instance(), RTTR::memberOffset<&T::Name>() }); \
 } \
 while (false)
 
@@ -57,28 +141,29 @@ while (false)
 #define RTTR_REGISTER_STATIC_METHOD(T, Interview, Name, ...) \
 do \
 { \
-	using R = std::invoke_result_t<decltype(T::Name), __VA_ARGS__>; \
-	R (*address)(__VA_ARGS__){ T::Name }; \
-	RTTR::RealRTTRInfo<T>::instance()->registerStaticMethod({ #Name, Interview, RTTR::RealRTTRInfo<R>::instance(), address, RTTR::unpackArgsInfo<__VA_ARGS__>() }); \
+	static_assert(!RTTR::hasStaticInfo<T>, "T declares RTTR::static_info, its members and methods are registered from it"); \
+	constexpr auto address{ RTTR::overload<__VA_ARGS__>::of(&T::Name) }; \
+	using R = typename RTTR::function_traits<std::remove_const_t<decltype(address)>>::return_t; \
+	RTTR::RealRTTRInfo<T>::instance()->registerStaticMethod({ #Name, Interview, RTTR::RealRTTRInfo<R>::instance(), address, &RTTR::invoker<address>, RTTR::unpackArgsInfo<__VA_ARGS__>() }); \
 } \
 while (false)
 
 //עͨ
-#define RTTR_REGISTER_NORMAL_METHOD(Interview, R, Name, ...) \
+#define RTTR_REGISTER_NORMAL_METHOD(T, Interview, R, Name, ...) \
 do \
 { \
-	using T = std::remove_const_t<std::remove_reference_t<decltype(*this)>>; \
-	R (T::*address)(__VA_ARGS__){ &T::Name }; \
-	RTTR::RealRTTRInfo<T>::instance()->registerNormalMethod({ #Name, Interview, RTTR::RealRTTRInfo<R>::instance(), address, RTTR::unpackArgsInfo<__VA_ARGS__>() }); \
+	static_assert(!RTTR::hasStaticInfo<T>, "T declares RTTR::static_info, its members and methods are registered from it"); \
+	constexpr R (T::*address)(__VA_ARGS__){ &T::Name }; \
+	RTTR::RealRTTRInfo<T>::instance()->registerNormalMethod({ #Name, Interview, RTTR::RealRTTRInfo<R>::instance(), address, &RTTR::invoker<address>, RTTR::unpackArgsInfo<__VA_ARGS__>() }); \
 } \
 while (false)
 
 //עconst
-#define RTTR_REGISTER_CONST_METHOD(Interview, R, Name, ...) \
+#define RTTR_REGISTER_CONST_METHOD(T, Interview, R, Name, ...) \
 do \
 { \
-	using T = std::remove_const_t<std::remove_reference_t<decltype(*this)>>; \
-	R (T::*address)(__VA_ARGS__) const { &T::Name }; \
-	RTTR::RealRTTRInfo<T>::instance()->registerConstMethod({ #Name, Interview, RTTR::RealRTTRInfo<R>::instance(), address, RTTR::unpackArgsInfo<__VA_ARGS__>() }); \
+	static_assert(!RTTR::hasStaticInfo<T>, "T declares RTTR::static_info, its members and methods are registered from it"); \
+	constexpr R (T::*address)(__VA_ARGS__) const { &T::Name }; \
+	RTTR::RealRTTRInfo<T>::instance()->registerConstMethod({ #Name, Interview, RTTR::RealRTTRInfo<R>::instance(), address, &RTTR::invoker<address>, RTTR::unpackArgsInfo<__VA_ARGS__>() }); \
 } \
 while (false)
@@ -0,0 +1,68 @@
+#include <algorithm>
+
+#include "RTTRSerialize.hpp"
+
+RTTR::BinaryPlan RTTR::BinaryPlan::build(const RTTRInfo& info)
+{
+	BinaryPlan plan{};
+
+	std::vector<const NormalMemberInfo*> members{};
+	for (const auto& member : info.normalMembers()) members.push_back(&member);
+	std::stable_sort(members.begin(), members.end(), [](const NormalMemberInfo* lhs, const NormalMemberInfo* rhs) { return lhs->offset < rhs->offset; });
+
+	if (members.empty() && info.trivial())
+	{
+		plan.steps.push_back({ 0, info.size(), nullptr });
+		plan.minSize = info.size();
+		return plan;
+	}
+
+	for (auto member : members)
+	{
+		if (!member->info->trivial())
+		{
+			plan.steps.push_back({ member->offset, 0, member->info });
+			plan.minSize += member->info->plan<BinaryPlan>(&BinaryPlan::build).minSize;
+			continue;
+		}
+
+		//һmemcpyĿƽƳԱö
+		auto size{ member->info->size() };
+		plan.minSize += size;
+		if (!plan.steps.empty() && nullptr == plan.steps.back().info && plan.steps.back().offset + static_cast<int>(plan.steps.back().size) == member->offset)
+			plan.steps.back().size += size;
+		else
+			plan.steps.push_back({ member->offset, size, nullptr });
+	}
+	return plan;
+}
+
+void RTTR::writeMembers(const RTTRInfo& info, const void* o, BinaryWriter& writer)
+{
+	writeMembers(info.plan<BinaryPlan>(&BinaryPlan::build), o, writer);
+}
+
+void RTTR::writeMembers(const BinaryPlan& plan, const void* o, BinaryWriter& writer)
+{
+	auto object{ static_cast<const unsigned char*>(o) };
+	for (const auto& step : plan.steps)
+	{
+		if (step.info) step.info->serialize(object + step.offset, writer);
+		else writer.write(object + step.offset, step.size);
+	}
+}
+
+bool RTTR::readMembers(const RTTRInfo& info, void* o, BinaryReader& reader)
+{
+	return readMembers(info.plan<BinaryPlan>(&BinaryPlan::build), o, reader);
+}
+
+bool RTTR::readMembers(const BinaryPlan& plan, void* o, BinaryReader& reader)
+{
+	auto object{ static_cast<unsigned char*>(o) };
+	for (const auto& step : plan.steps)
+	{
+		if (!(step.info ? step.info->deserialize(object + step.offset, reader) : reader.read(object + step.offset, step.size))) return false;
+	}
+	return true;
+}
@@ -0,0 +1,429 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "RTTRInfo/RTTRInfo.h"
+
+namespace RTTR
+{
+	/// <summary>
+	/// 壬clear()ڶл֮临
+	/// </summary>
+	class BinaryWriter
+	{
+	public:
+		void write(const void* data, size_t size)
+		{
+			auto offset{ m_buffer.size() };
+			m_buffer.resize(offset + size);
+			if (size) std::memcpy(m_buffer.data() + offset, data, size);
+		}
+
+		template<typename T>
+		void write(const T& value) { static_assert(std::is_trivially_copyable_v<T>); write(&value, sizeof(T)); }
+
+		void clear() { m_buffer.clear(); }
+		void truncate(size_t size) { assert(size <= m_buffer.size()); m_buffer.resize(size); }
+		void reserve(size_t size) { m_buffer.reserve(size); }
+
+		const unsigned char* data() const { return m_buffer.data(); }
+		size_t size() const { return m_buffer.size(); }
+
+	private:
+		std::vector<unsigned char> m_buffer{};
+	};
+
+	/// <summary>
+	/// 룬ԽȡfalseҲƶȡλ
+	/// </summary>
+	class BinaryReader
+	{
+	public:
+		BinaryReader(const void* data, size_t size) : m_data(static_cast<const unsigned char*>(data)), m_size(size) {}
+
+	public:
+		bool read(void* data, size_t size)
+		{
+			if (size > remaining()) return false;
+			if (size) std::memcpy(data, m_data + m_position, size);
+			m_position += size;
+			return true;
+		}
+
+		template<typename T>
+		bool read(T& value) { static_assert(std::is_trivially_copyable_v<T>); return read(&value, sizeof(T)); }
+
+		size_t remaining() const { return m_size - m_position; }
+
+	private:
+		const unsigned char* m_data;
+		size_t m_size;
+		size_t m_position{ 0 };
+	};
+
+	/// <summary>
+	/// лƻƫͨԱڵĿƽƳԱϲΪһmemcpy
+	/// </summary>
+	struct BinaryPlan
+	{
+	public:
+		struct Step
+		{
+		public:
+			int offset;
+			size_t size;				//infoΪnullptrʱΪmemcpyֽ
+			const RTTRInfo* info;		//ƽƵĳԱϢݹл
+		};
+
+	public:
+		/// <summary>
+		/// Ϣлƻ
+		/// ûעͨԱĿƽmemcpy
+		/// </summary>
+		/// <param name="info"></param>
+		/// <returns></returns>
+		static BinaryPlan build(const RTTRInfo& info);
+
+	public:
+		std::vector<Step> steps{};
+		size_t minSize{ 0 };			//СֽûעԱķƽԱ(std::string)0ƣ½
+	};
+
+	/// <summary>
+	/// лƻдͨԱ
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o"></param>
+	/// <param name="writer"></param>
+	void writeMembers(const RTTRInfo& info, const void* o, BinaryWriter& writer);
+
+	/// <summary>
+	/// лƻдлͬͶʱظȡƻ
+	/// </summary>
+	/// <param name="plan"></param>
+	/// <param name="o"></param>
+	/// <param name="writer"></param>
+	void writeMembers(const BinaryPlan& plan, const void* o, BinaryWriter& writer);
+
+	/// <summary>
+	/// лƻȡͨԱ
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o">ѹĶ</param>
+	/// <param name="reader"></param>
+	/// <returns>ݲʱfalse</returns>
+	bool readMembers(const RTTRInfo& info, void* o, BinaryReader& reader);
+
+	/// <summary>
+	/// лƻȡ
+	/// </summary>
+	/// <param name="plan"></param>
+	/// <param name="o">ѹĶ</param>
+	/// <param name="reader"></param>
+	/// <returns>ݲʱfalse</returns>
+	bool readMembers(const BinaryPlan& plan, void* o, BinaryReader& reader);
+
+	/// <summary>
+	/// TĶƱ
+	/// ͵ĿƽֱmemcpyͰעͨԱл׼·ػ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	struct BinaryCodec
+	{
+	public:
+		static constexpr bool leaf{ std::is_trivially_copyable_v<T> && !std::is_class_v<T> };
+
+		/// <summary>
+		/// Ҷ͵лƻ
+		/// </summary>
+		/// <returns></returns>
+		static const BinaryPlan& plan() { return RealRTTRInfo<T>::instance()->template plan<BinaryPlan>(&BinaryPlan::build); }
+
+		/// <summary>
+		/// СֽȡԪظʱƷ
+		/// </summary>
+		/// <returns></returns>
+		static size_t minSize()
+		{
+			if constexpr (leaf) return sizeof(T);
+			else return plan().minSize;
+		}
+
+	public:
+		static void write(BinaryWriter& writer, const T& value)
+		{
+			if constexpr (leaf) writer.write(value);
+			else writeMembers(*RealRTTRInfo<T>::instance(), &value, writer);
+		}
+
+		static bool read(BinaryReader& reader, T& value)
+		{
+			if constexpr (leaf) return reader.read(value);
+			else return readMembers(*RealRTTRInfo<T>::instance(), &value, reader);
+		}
+	};
+
+	/// <summary>
+	/// ȡԪظʣֽԱôԪʱΪ
+	/// ԪرСֽƸ벻öȡԶڴ
+	/// </summary>
+	/// <param name="reader"></param>
+	/// <param name="count"></param>
+	/// <param name="minSize">ԪرСֽΪ0ʱ1</param>
+	/// <returns></returns>
+	inline bool readCount(BinaryReader& reader, uint64_t& count, size_t minSize)
+	{
+		return reader.read(count) && count <= reader.remaining() / std::max<size_t>(1, minSize);
+	}
+
+	template<>
+	struct BinaryCodec<std::string>
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+		static size_t minSize() { return sizeof(uint64_t); }
+
+	public:
+		static void write(BinaryWriter& writer, const std::string& value)
+		{
+			writer.write(static_cast<uint64_t>(value.size()));
+			writer.write(value.data(), value.size());
+		}
+
+		static bool read(BinaryReader& reader, std::string& value)
+		{
+			uint64_t size{ 0 };
+			if (!readCount(reader, size, 1)) return false;
+
+			value.resize(size);
+			return reader.read(value.data(), size);
+		}
+	};
+
+	/// <summary>
+	/// ˳ԪؿƽƵstd::vectormemcpyɵСԭضԪ
+	/// </summary>
+	template<typename C>
+	struct SequenceCodec
+	{
+	public:
+		using E = typename C::value_type;
+
+		static constexpr bool leaf{ true };
+		static constexpr bool contiguous{ std::is_same_v<C, std::vector<E, typename C::allocator_type>> && !std::is_same_v<E, bool> && BinaryCodec<E>::leaf && std::is_trivially_copyable_v<E> };
+
+		static size_t minSize() { return sizeof(uint64_t); }
+
+	public:
+		static void write(BinaryWriter& writer, const C& value)
+		{
+			writer.write(static_cast<uint64_t>(value.size()));
+			if constexpr (contiguous) writer.write(value.data(), value.size() * sizeof(E));
+			else if constexpr (!BinaryCodec<E>::leaf)
+			{
+				const auto& plan{ BinaryCodec<E>::plan() };
+				for (const auto& element : value) writeMembers(plan, &element, writer);
+			}
+			else for (const auto& element : value) BinaryCodec<E>::write(writer, element);
+		}
+
+		static bool read(BinaryReader& reader, C& value)
+		{
+			uint64_t size{ 0 };
+			if (!readCount(reader, size, BinaryCodec<E>::minSize())) return false;
+
+			if constexpr (contiguous)
+			{
+				value.resize(size);
+				return reader.read(value.data(), size * sizeof(E));
+			}
+			else if constexpr (requires { value.resize(size); })
+			{
+				//Ԫأ練ͬһstd::vectorʱַ·
+				value.resize(size);
+				if constexpr (!BinaryCodec<E>::leaf)
+				{
+					const auto& plan{ BinaryCodec<E>::plan() };
+					for (auto& element : value)
+						if (!readMembers(plan, &element, reader)) return false;
+				}
+				else
+				{
+					for (auto& element : value)
+						if (!BinaryCodec<E>::read(reader, element)) return false;
+				}
+				return true;
+			}
+			else
+			{
+				value.clear();
+				for (uint64_t i = 0; i < size; ++i)
+				{
+					E element{};
+					if (!BinaryCodec<E>::read(reader, element)) return false;
+					value.insert(value.end(), std::move(element));
+				}
+				return true;
+			}
+		}
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	template<typename C>
+	struct AssociativeCodec
+	{
+	public:
+		using E = std::pair<std::remove_const_t<typename C::value_type::first_type>, typename C::value_type::second_type>;
+
+		static constexpr bool leaf{ true };
+
+		static size_t minSize() { return sizeof(uint64_t); }
+
+	public:
+		static void write(BinaryWriter& writer, const C& value)
+		{
+			writer.write(static_cast<uint64_t>(value.size()));
+			for (const auto& [key, mapped] : value)
+			{
+				BinaryCodec<typename E::first_type>::write(writer, key);
+				BinaryCodec<typename E::second_type>::write(writer, mapped);
+			}
+		}
+
+		static bool read(BinaryReader& reader, C& value)
+		{
+			uint64_t size{ 0 };
+			if (!readCount(reader, size, BinaryCodec<E>::minSize())) return false;
+
+			value.clear();
+			for (uint64_t i = 0; i < size; ++i)
+			{
+				E element{};
+				if (!BinaryCodec<typename E::first_type>::read(reader, element.first) || !BinaryCodec<typename E::second_type>::read(reader, element.second)) return false;
+				value.insert(std::move(element));
+			}
+			return true;
+		}
+	};
+
+	template<typename E, typename A>
+	struct BinaryCodec<std::vector<E, A>> : SequenceCodec<std::vector<E, A>> {};
+
+	template<typename E, typename A>
+	struct BinaryCodec<std::deque<E, A>> : SequenceCodec<std::deque<E, A>> {};
+
+	template<typename E, typename A>
+	struct BinaryCodec<std::list<E, A>> : SequenceCodec<std::list<E, A>> {};
+
+	template<typename E, typename P, typename A>
+	struct BinaryCodec<std::set<E, P, A>> : SequenceCodec<std::set<E, P, A>> {};
+
+	template<typename E, typename H, typename P, typename A>
+	struct BinaryCodec<std::unordered_set<E, H, P, A>> : SequenceCodec<std::unordered_set<E, H, P, A>> {};
+
+	template<typename K, typename V, typename P, typename A>
+	struct BinaryCodec<std::map<K, V, P, A>> : AssociativeCodec<std::map<K, V, P, A>> {};
+
+	template<typename K, typename V, typename H, typename P, typename A>
+	struct BinaryCodec<std::unordered_map<K, V, H, P, A>> : AssociativeCodec<std::unordered_map<K, V, H, P, A>> {};
+
+	template<typename E, size_t N>
+	struct BinaryCodec<std::array<E, N>>
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+		static size_t minSize() { return N * BinaryCodec<E>::minSize(); }
+
+	public:
+		static void write(BinaryWriter& writer, const std::array<E, N>& value)
+		{
+			for (const auto& element : value) BinaryCodec<E>::write(writer, element);
+		}
+
+		static bool read(BinaryReader& reader, std::array<E, N>& value)
+		{
+			for (auto& element : value)
+				if (!BinaryCodec<E>::read(reader, element)) return false;
+			return true;
+		}
+	};
+
+	template<typename F, typename S>
+	struct BinaryCodec<std::pair<F, S>>
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+		static size_t minSize() { return BinaryCodec<F>::minSize() + BinaryCodec<S>::minSize(); }
+
+	public:
+		static void write(BinaryWriter& writer, const std::pair<F, S>& value)
+		{
+			BinaryCodec<F>::write(writer, value.first);
+			BinaryCodec<S>::write(writer, value.second);
+		}
+
+		static bool read(BinaryReader& reader, std::pair<F, S>& value)
+		{
+			return BinaryCodec<F>::read(reader, value.first) && BinaryCodec<S>::read(reader, value.second);
+		}
+	};
+
+	/// <summary>
+	/// RealRTTRInfo<T>::serializeʵ֣Ҷֱӱ룬Ͱлƻ
+	/// </summary>
+	template<typename T>
+	static void serializeObject(const RTTRInfo& info, const void* o, BinaryWriter& writer)
+	{
+		if constexpr (std::is_void_v<T>) return;
+		else if constexpr (BinaryCodec<T>::leaf) BinaryCodec<T>::write(writer, *static_cast<const T*>(o));
+		else writeMembers(info, o, writer);
+	}
+
+	/// <summary>
+	/// RealRTTRInfo<T>::deserializeʵ
+	/// </summary>
+	template<typename T>
+	static bool deserializeObject(const RTTRInfo& info, void* o, BinaryReader& reader)
+	{
+		if constexpr (std::is_void_v<T>) return true;
+		else if constexpr (BinaryCodec<T>::leaf) return BinaryCodec<T>::read(reader, *static_cast<T*>(o));
+		else return readMembers(info, o, reader);
+	}
+
+	/// <summary>
+	/// л
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="value"></param>
+	/// <param name="writer"></param>
+	template<typename T>
+	static void serialize(const T& value, BinaryWriter& writer) { BinaryCodec<T>::write(writer, value); }
+
+	/// <summary>
+	/// лѹĶ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	/// <param name="value"></param>
+	/// <param name="reader"></param>
+	/// <returns>ݲʱfalseʱvalueڲд״̬</returns>
+	template<typename T>
+	static bool deserialize(T& value, BinaryReader& reader) { return BinaryCodec<T>::read(reader, value); }
+}
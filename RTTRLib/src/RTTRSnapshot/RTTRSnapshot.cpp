@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "RTTRSnapshot.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ļʶʽ汾
+	/// </summary>
+	static constexpr char s_snapshotMagic[8]{ 'R', 'T', 'T', 'R', 'S', 'N', 'P', '2' };
+
+	/// <summary>
+	/// ֽǣд뷽ֽ洢ȡֽȽ
+	/// </summary>
+	static constexpr uint32_t s_snapshotByteOrder{ 0x01020304 };
+
+	/// <summary>
+	/// ¼Ķ룬ӳַҳ룬¼˶뼴ֱӰͷ
+	/// </summary>
+	static constexpr size_t s_snapshotAlignment{ 64 };
+
+	/// <summary>
+	/// ֽڲFNV-1aϣ
+	/// </summary>
+	static uint64_t hashLayout(uint64_t hash, const void* data, size_t size)
+	{
+		auto bytes{ static_cast<const unsigned char*>(data) };
+		for (size_t i = 0; i < size; ++i) hash = (hash ^ bytes[i]) * 1099511628211ull;
+		return hash;
+	}
+
+	/// <summary>
+	/// ͵ĲָƣƫͨԱ֡ƫơСԱ͵ָ
+	/// ûעͨԱͷ0䲼ֻС
+	/// </summary>
+	/// <param name="info"></param>
+	/// <returns></returns>
+	static uint64_t layoutOf(const RTTRInfo& info)
+	{
+		std::vector<const NormalMemberInfo*> members{};
+		for (const auto& member : info.normalMembers()) members.push_back(&member);
+		if (members.empty()) return 0;
+
+		std::stable_sort(members.begin(), members.end(), [](const NormalMemberInfo* lhs, const NormalMemberInfo* rhs) { return lhs->offset < rhs->offset; });
+
+		uint64_t hash{ 14695981039346656037ull };
+		for (auto member : members)
+		{
+			auto typeName{ member->info->name() };
+			uint64_t layout[]{ member->name.size(), typeName.size(), static_cast<uint64_t>(member->offset), member->info->size(), layoutOf(*member->info) };
+			hash = hashLayout(hash, member->name.data(), member->name.size());
+			hash = hashLayout(hash, typeName.data(), typeName.size());
+			hash = hashLayout(hash, layout, sizeof(layout));
+		}
+		return hash;
+	}
+
+	/// <summary>
+	/// Ϣֶαƫ
+	/// </summary>
+	/// <param name="info"></param>
+	/// <returns></returns>
+	static std::vector<SnapshotField> snapshotFields(const RTTRInfo& info)
+	{
+		std::vector<SnapshotField> fields{};
+		for (const auto& member : info.normalMembers())
+			fields.push_back({ std::string{ member.name }, std::string{ member.info->name() }, static_cast<uint32_t>(member.offset), static_cast<uint32_t>(member.info->size()), layoutOf(*member.info) });
+
+		std::stable_sort(fields.begin(), fields.end(), [](const SnapshotField& lhs, const SnapshotField& rhs) { return lhs.offset < rhs.offset; });
+		return fields;
+	}
+
+	/// <summary>
+	/// ֶε֡벼Ƿһ£һʱֶεֽڿֱӸ
+	/// </summary>
+	static bool sameField(const SnapshotField& lhs, const SnapshotField& rhs)
+	{
+		return lhs.size == rhs.size && lhs.layout == rhs.layout && lhs.name == rhs.name && lhs.typeName == rhs.typeName;
+	}
+}
+
+bool RTTR::writeSnapshot(const std::filesystem::path& path, const RTTRInfo& info, const void* objects, size_t count)
+{
+	assert(objects || !count);
+	if (!info.trivial() || (nullptr == objects && count)) return false;
+
+	BinaryWriter header{};
+	header.write(s_snapshotMagic, sizeof(s_snapshotMagic));
+	header.write(s_snapshotByteOrder);
+	header.write(uint32_t{ 0 });			//¼ƫƣ
+	header.write(static_cast<uint32_t>(info.size()));
+	header.write(static_cast<uint64_t>(count));
+	serialize(std::string{ info.name() }, header);
+
+	auto fields{ snapshotFields(info) };
+	header.write(static_cast<uint32_t>(fields.size()));
+	for (const auto& field : fields)
+	{
+		serialize(field.name, header);
+		serialize(field.typeName, header);
+		header.write(field.offset);
+		header.write(field.size);
+		header.write(field.layout);
+	}
+
+	static constexpr unsigned char s_padding[s_snapshotAlignment]{};
+	header.write(s_padding, (s_snapshotAlignment - header.size() % s_snapshotAlignment) % s_snapshotAlignment);
+
+	auto recordsOffset{ static_cast<uint32_t>(header.size()) };
+	std::vector<unsigned char> bytes(header.data(), header.data() + header.size());
+	std::memcpy(bytes.data() + sizeof(s_snapshotMagic) + sizeof(s_snapshotByteOrder), &recordsOffset, sizeof(recordsOffset));
+
+	std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+	file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	file.write(static_cast<const char*>(objects), static_cast<std::streamsize>(info.size() * count));
+	return file.good();
+}
+
+RTTR::Snapshot::~Snapshot()
+{
+	close();
+}
+
+bool RTTR::Snapshot::open(const std::filesystem::path& path)
+{
+	close();
+
+#ifdef _WIN32
+	auto file{ CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+	if (file == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER size{};
+	GetFileSizeEx(file, &size);
+	auto mapping{ size.QuadPart ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr };
+	CloseHandle(file);
+	if (nullptr == mapping) return false;
+
+	m_mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (nullptr == m_mapping) return false;
+	m_mappingSize = static_cast<size_t>(size.QuadPart);
+#else
+	auto file{ ::open(path.c_str(), O_RDONLY) };
+	if (file < 0) return false;
+
+	struct stat status {};
+	auto mapping{ fstat(file, &status) == 0 && status.st_size > 0 ? mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED };
+	::close(file);
+	if (mapping == MAP_FAILED) return false;
+
+	m_mapping = mapping;
+	m_mappingSize = static_cast<size_t>(status.st_size);
+#endif
+
+	char magic[sizeof(s_snapshotMagic)]{};
+	uint32_t byteOrder{ 0 };
+	uint32_t recordsOffset{ 0 };
+	uint64_t count{ 0 };
+	uint32_t fieldCount{ 0 };
+
+	BinaryReader reader{ m_mapping, m_mappingSize };
+	auto valid{ reader.read(magic, sizeof(magic)) && std::equal(std::begin(magic), std::end(magic), s_snapshotMagic) &&
+		reader.read(byteOrder) && s_snapshotByteOrder == byteOrder &&
+		reader.read(recordsOffset) && reader.read(m_recordSize) && reader.read(count) && deserialize(m_typeName, reader) && reader.read(fieldCount) };
+
+	for (uint32_t i = 0; valid && i < fieldCount; ++i)
+	{
+		auto& field{ m_fields.emplace_back() };
+		valid = deserialize(field.name, reader) && deserialize(field.typeName, reader) && reader.read(field.offset) && reader.read(field.size) && reader.read(field.layout) &&
+			static_cast<uint64_t>(field.offset) + field.size <= m_recordSize;
+	}
+
+	valid = valid && recordsOffset % s_snapshotAlignment == 0 && recordsOffset <= m_mappingSize && m_recordSize &&
+		count <= (m_mappingSize - recordsOffset) / m_recordSize;
+	if (!valid)
+	{
+		close();
+		return false;
+	}
+
+	m_count = static_cast<size_t>(count);
+	m_records = static_cast<const unsigned char*>(m_mapping) + recordsOffset;
+	return true;
+}
+
+void RTTR::Snapshot::close()
+{
+	if (m_mapping)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(m_mapping);
+#else
+		munmap(m_mapping, m_mappingSize);
+#endif
+	}
+
+	m_mapping = nullptr;
+	m_mappingSize = 0;
+	m_typeName.clear();
+	m_fields.clear();
+	m_recordSize = 0;
+	m_count = 0;
+	m_records = nullptr;
+}
+
+bool RTTR::Snapshot::matches(const RTTRInfo& info) const
+{
+	if (nullptr == m_records || m_recordSize != info.size()) return false;
+
+	auto fields{ snapshotFields(info) };
+	return std::equal(fields.begin(), fields.end(), m_fields.begin(), m_fields.end(), [](const SnapshotField& lhs, const SnapshotField& rhs)
+		{
+			return lhs.offset == rhs.offset && sameField(lhs, rhs);
+		});
+}
+
+void RTTR::Snapshot::load(const RTTRInfo& info, void* objects) const
+{
+	auto target{ static_cast<unsigned char*>(objects) };
+	if (matches(info))
+	{
+		if (m_count) std::memcpy(target, m_records, m_count * m_recordSize);
+		return;
+	}
+
+	//ֶɸƲ裬ԴĿ궼ڵĲϲ
+	struct Step
+	{
+	public:
+		uint32_t from;
+		uint32_t to;
+		uint32_t size;
+	};
+
+	std::vector<Step> steps{};
+	for (const auto& field : snapshotFields(info))
+	{
+		auto source{ std::find_if(m_fields.begin(), m_fields.end(), [&field](const SnapshotField& val) { return val.name == field.name; }) };
+		if (source == m_fields.end() || !sameField(*source, field)) continue;
+
+		if (!steps.empty() && steps.back().from + steps.back().size == source->offset && steps.back().to + steps.back().size == field.offset)
+			steps.back().size += field.size;
+		else
+			steps.push_back({ source->offset, field.offset, field.size });
+	}
+
+	auto stride{ info.size() };
+	for (size_t i = 0; i < m_count; ++i)
+	{
+		auto record{ m_records + i * m_recordSize };
+		auto object{ target + i * stride };
+		for (const auto& step : steps) std::memcpy(object + step.to, record + step.from, step.size);
+	}
+}
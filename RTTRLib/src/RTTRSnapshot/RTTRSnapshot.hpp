@@ -0,0 +1,139 @@
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "RTTRInfo/RTTRInfo.h"
+#include "RTTRSerialize/RTTRSerialize.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// м¼һֶ
+	/// </summary>
+	struct SnapshotField
+	{
+	public:
+		std::string name;
+		std::string typeName;
+		uint32_t offset;
+		uint32_t size;
+		uint64_t layout;		//ֶ͵ĲָƣעͨԱݹɣûעԱΪ0
+	};
+
+	/// <summary>
+	/// дգļͷϢɵֶα¼ԭʼڴ沼ֽв64ֽڶ
+	/// ֻֿ֧ƽƵֽͣд뷽Ļͬļͷ¼ֽֽͬĻʧ
+	/// </summary>
+	/// <param name="path">ļ·</param>
+	/// <param name="info">¼Ϣ</param>
+	/// <param name="objects">һ</param>
+	/// <param name="count"></param>
+	/// <returns>Ͳƽƻдʧʱfalse</returns>
+	bool writeSnapshot(const std::filesystem::path& path, const RTTRInfo& info, const void* objects, size_t count);
+
+	template<typename T>
+	static bool writeSnapshot(const std::filesystem::path& path, std::span<const T> objects)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Snapshot records must be trivially copyable");
+		return writeSnapshot(path, *RealRTTRInfo<T>::instance(), objects.data(), objects.size());
+	}
+
+	/// <summary>
+	/// ֻգڴӳ䷽ʽ
+	/// ֶα뵱ǰעһʱֱӷӳڴϵͼֶӳ䵽²
+	/// </summary>
+	class Snapshot
+	{
+	public:
+		Snapshot() = default;
+		Snapshot(const Snapshot&) = delete;
+		Snapshot& operator =(const Snapshot&) = delete;
+		~Snapshot();
+
+	public:
+		/// <summary>
+		/// ӳļļͷ
+		/// </summary>
+		/// <param name="path"></param>
+		/// <returns>ļڡļͷ𻵻ֽ뱾ͬʱfalse</returns>
+		bool open(const std::filesystem::path& path);
+
+		/// <summary>
+		/// ӳ
+		/// </summary>
+		void close();
+
+		/// <summary>
+		/// дʱ
+		/// </summary>
+		/// <returns></returns>
+		std::string_view typeName() const { return m_typeName; }
+
+		/// <summary>
+		/// дʱֶα
+		/// </summary>
+		/// <returns></returns>
+		const std::vector<SnapshotField>& fields() const { return m_fields; }
+
+		/// <summary>
+		/// ¼
+		/// </summary>
+		/// <returns></returns>
+		size_t count() const { return m_count; }
+
+		/// <summary>
+		/// ֶα¼СǷinfoȫһ£һʱ¼ֱӰinfoͷ
+		/// ֻȽϲ֣Ƚ
+		/// </summary>
+		/// <param name="info"></param>
+		/// <returns></returns>
+		bool matches(const RTTRInfo& info) const;
+
+		/// <summary>
+		/// ӳڴϵֻͼ
+		/// </summary>
+		/// <typeparam name="T"></typeparam>
+		/// <returns>TһʱΪ</returns>
+		template<typename T>
+		std::span<const T> view() const
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Snapshot records must be trivially copyable");
+			if (!matches(*RealRTTRInfo<T>::instance())) return {};
+			return { reinterpret_cast<const T*>(m_records), m_count };
+		}
+
+		/// <summary>
+		/// ֶѼ¼ƵѹĶ
+		/// ֡С벼ָƶһµֶαƣֶαԭֵǶ͵Ĳֱ仯ֶβ
+		/// </summary>
+		/// <param name="info">ĿϢ</param>
+		/// <param name="objects">count()󣬼Ϊinfo.size()</param>
+		void load(const RTTRInfo& info, void* objects) const;
+
+		/// <summary>
+		/// ȡȫ¼һʱ帴ƣֶӳ
+		/// </summary>
+		/// <typeparam name="T"></typeparam>
+		/// <param name="objects">Ϊcount()ĬϹĶд</param>
+		template<typename T>
+		void load(std::vector<T>& objects) const
+		{
+			objects.assign(m_count, T{});
+			load(*RealRTTRInfo<T>::instance(), objects.data());
+		}
+
+	private:
+		void* m_mapping{ nullptr };
+		size_t m_mappingSize{ 0 };
+
+		std::string m_typeName{};
+		std::vector<SnapshotField> m_fields{};
+		uint32_t m_recordSize{ 0 };
+		size_t m_count{ 0 };
+		const unsigned char* m_records{ nullptr };
+	};
+}
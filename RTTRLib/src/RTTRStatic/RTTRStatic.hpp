@@ -0,0 +1,196 @@
+#pragma once
+
+#include <tuple>
+#include <string_view>
+#include <type_traits>
+
+#include "RTTRInfo/RTTRInfo.h"
+
+//ڳԱ̬ԱͨԱɳԱָԶ
+#define RTTR_MEMBER(T, Interview, Name) RTTR::MemberDescriptor<&T::Name>{ #Name, Interview }
+
+//ڷ̬ͨconstɺָԶ
+#define RTTR_METHOD(T, Interview, Name) RTTR::MethodDescriptor<&T::Name>{ #Name, Interview }
+
+//طıĺָ
+#define RTTR_OVERLOAD(T, Interview, Name, ...) RTTR::MethodDescriptor<static_cast<__VA_ARGS__>(&T::Name)>{ #Name, Interview }
+
+namespace RTTR
+{
+	/// <summary>
+	/// ڳԱ
+	/// ԱָΪģУʱֱ
+	/// </summary>
+	/// <typeparam name="Pointer">&T::Name</typeparam>
+	template<auto Pointer>
+	struct MemberDescriptor
+	{
+	public:
+		using pointer_t = decltype(Pointer);
+		using value_t = typename member_traits<pointer_t>::value_t;
+
+		static_assert(!std::is_function_v<value_t>, "MemberDescriptor requires a data member, use RTTR_METHOD for methods");
+
+	public:
+		static constexpr pointer_t pointer{ Pointer };
+		static constexpr bool isStatic{ !std::is_member_object_pointer_v<pointer_t> };
+
+	public:
+		std::string_view name;
+		Interview interview;
+	};
+
+	/// <summary>
+	/// ڷ
+	/// </summary>
+	/// <typeparam name="Pointer">&T::Name</typeparam>
+	template<auto Pointer>
+	struct MethodDescriptor
+	{
+	public:
+		using pointer_t = decltype(Pointer);
+		using return_t = typename function_traits<pointer_t>::return_t;
+		using class_t = typename function_traits<pointer_t>::class_t;
+		using args_t = typename function_traits<pointer_t>::args_t;
+
+	public:
+		static constexpr pointer_t pointer{ Pointer };
+		static constexpr bool isStatic{ std::is_void_v<class_t> };
+		static constexpr bool isConst{ std::is_const_v<class_t> };
+
+	public:
+		std::string_view name;
+		Interview interview;
+	};
+
+	/// <summary>
+	/// ͵ıڷ
+	/// ͨʽػmembersmethodsconstexprԪ飬עregisterStaticInfoͬһ
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	struct static_info {};
+
+	/// <summary>
+	/// TǷstatic_info˵͵ĳԱ뷽ֻregisterStaticInfoע
+	/// </summary>
+	template<typename T>
+	inline constexpr bool hasStaticInfo{ requires { static_info<T>::members; } || requires { static_info<T>::methods; } };
+
+	/// <summary>
+	/// ȡTıڳԱԪ飬δʱΪԪ
+	/// </summary>
+	template<typename T>
+	static constexpr auto staticMembers()
+	{
+		if constexpr (requires { static_info<T>::members; }) return static_info<T>::members;
+		else return std::tuple<>{};
+	}
+
+	/// <summary>
+	/// ȡTıڷԪ飬δʱΪԪ
+	/// </summary>
+	template<typename T>
+	static constexpr auto staticMethods()
+	{
+		if constexpr (requires { static_info<T>::methods; }) return static_info<T>::methods;
+		else return std::tuple<>{};
+	}
+
+	/// <summary>
+	/// ڱTȫԱ
+	/// </summary>
+	/// <param name="func">func(member)</param>
+	template<typename T, typename F>
+	static constexpr void for_each_member(F&& func)
+	{
+		std::apply([&](const auto&... member) { (func(member), ...); }, staticMembers<T>());
+	}
+
+	/// <summary>
+	/// ڱoͨԱ̬Ա
+	/// </summary>
+	/// <param name="o">constõconst</param>
+	/// <param name="func">func(member, o.*member.pointer)</param>
+	template<typename O, typename F>
+	static constexpr void for_each_member(O&& o, F&& func)
+	{
+		for_each_member<std::remove_cvref_t<O>>([&](const auto& member)
+			{
+				if constexpr (!std::remove_cvref_t<decltype(member)>::isStatic) func(member, o.*member.pointer);
+			});
+	}
+
+	/// <summary>
+	/// ڱTȫ
+	/// </summary>
+	/// <param name="func">func(method)</param>
+	template<typename T, typename F>
+	static constexpr void for_each_method(F&& func)
+	{
+		std::apply([&](const auto&... method) { (func(method), ...); }, staticMethods<T>());
+	}
+
+	/// <summary>
+	/// ڰƲҳԱ±
+	/// </summary>
+	/// <returns>δҵسԱ</returns>
+	template<typename T>
+	static constexpr size_t staticMemberIndex(std::string_view name)
+	{
+		size_t index{ 0 };
+		size_t found{ std::tuple_size_v<decltype(staticMembers<T>())> };
+		for_each_member<T>([&](const auto& member)
+			{
+				if (found == std::tuple_size_v<decltype(staticMembers<T>())> && member.name == name) found = index;
+				++index;
+			});
+		return found;
+	}
+
+	/// <summary>
+	/// ԪȡϢ
+	/// </summary>
+	template<typename... Args>
+	static std::span<RTTRInfo* const> unpackTupleArgsInfo(std::type_identity<std::tuple<Args...>>) { return unpackArgsInfo<Args...>(); }
+
+	/// <summary>
+	/// һڳԱעᵽڱ
+	/// </summary>
+	template<auto Pointer>
+	static bool registerStatic(RTTRInfo* info, const MemberDescriptor<Pointer>& member)
+	{
+		using value_t = typename MemberDescriptor<Pointer>::value_t;
+		if constexpr (MemberDescriptor<Pointer>::isStatic) return info->registerStaticMember({ member.name, member.interview, RealRTTRInfo<value_t>::instance(), Pointer });
+		else return info->registerNormalMember({ member.name, member.interview, RealRTTRInfo<value_t>::instance(), memberOffset<Pointer>() });
+	}
+
+	/// <summary>
+	/// һڷעᵽڱ
+	/// </summary>
+	template<auto Pointer>
+	static bool registerStatic(RTTRInfo* info, const MethodDescriptor<Pointer>& method)
+	{
+		using method_t = MethodDescriptor<Pointer>;
+		auto returnInfo{ RealRTTRInfo<typename method_t::return_t>::instance() };
+		auto args{ unpackTupleArgsInfo(std::type_identity<typename method_t::args_t>{}) };
+		if constexpr (method_t::isStatic) return info->registerStaticMethod({ method.name, method.interview, returnInfo, Pointer, &invoker<Pointer>, args });
+		else if constexpr (method_t::isConst) return info->registerConstMethod({ method.name, method.interview, returnInfo, Pointer, &invoker<Pointer>, args });
+		else return info->registerNormalMethod({ method.name, method.interview, returnInfo, Pointer, &invoker<Pointer>, args });
+	}
+
+	/// <summary>
+	/// static_info<T>TڳԱ뷽
+	/// RTTR::Registration<T>ִעǰԶãעвúעԱ뷽᲻һ
+	/// </summary>
+	/// <returns>ȫעɹtrue</returns>
+	template<typename T>
+	static bool registerStaticInfo()
+	{
+		auto info{ RealRTTRInfo<T>::instance() };
+		bool succeed{ true };
+		for_each_member<T>([&](const auto& member) { succeed = registerStatic(info, member) && succeed; });
+		for_each_method<T>([&](const auto& method) { succeed = registerStatic(info, method) && succeed; });
+		return succeed;
+	}
+}
@@ -0,0 +1,133 @@
+#include <algorithm>
+
+#include "RTTRValue.hpp"
+
+RTTR::ValuePlan RTTR::ValuePlan::build(const RTTRInfo& info)
+{
+	ValuePlan plan{};
+
+	//ͨԱĳԱƫƼڶеƫ
+	std::vector<std::pair<const NormalMemberInfo*, int>> members{};
+	for (const auto& ancestor : info.ancestors())
+	{
+		if (ancestor.offset == Superclass::UnknownOffset)
+		{
+			assert(ancestor.info->normalMembers().empty() && "A virtual or ambiguous superclass has normal members that cannot be located in the object");
+			continue;
+		}
+		for (const auto& member : ancestor.info->normalMembers()) members.push_back({ &member, static_cast<int>(ancestor.offset) + member.offset });
+	}
+	std::stable_sort(members.begin(), members.end(), [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+
+	if (members.empty())
+	{
+		if (info.bytewise()) plan.steps.push_back({ 0, info.size(), nullptr });
+		plan.bytewise = info.bytewise();
+		return plan;
+	}
+
+	for (auto [member, offset] : members)
+	{
+		auto size{ member->info->size() };
+		auto packed{ member->info->bytewise() || (member->info->trivial() && member->info->plan<ValuePlan>(&ValuePlan::build).bytewise) };
+		if (!packed)
+		{
+			plan.steps.push_back({ offset, size, member->info });
+			continue;
+		}
+
+		//һεĿɰֽڱȽϵĳԱö
+		if (!plan.steps.empty() && nullptr == plan.steps.back().info && plan.steps.back().offset + static_cast<int>(plan.steps.back().size) == offset)
+			plan.steps.back().size += size;
+		else
+			plan.steps.push_back({ offset, size, nullptr });
+	}
+
+	plan.bytewise = 1 == plan.steps.size() && nullptr == plan.steps[0].info && 0 == plan.steps[0].offset && info.size() == plan.steps[0].size;
+	return plan;
+}
+
+bool RTTR::equalMembers(const RTTRInfo& info, const void* lhs, const void* rhs)
+{
+	return equalMembers(info.plan<ValuePlan>(&ValuePlan::build), lhs, rhs);
+}
+
+bool RTTR::equalMembers(const ValuePlan& plan, const void* lhs, const void* rhs)
+{
+	assert(lhs != nullptr && rhs != nullptr);
+
+	if (plan.steps.empty())
+	{
+		assert(false && "The type has no registered normal members, no operator== and is not bytewise comparable");
+		return lhs == rhs;
+	}
+
+	auto l{ static_cast<const unsigned char*>(lhs) };
+	auto r{ static_cast<const unsigned char*>(rhs) };
+	for (const auto& step : plan.steps)
+	{
+		if (nullptr == step.info)
+		{
+			if (0 != std::memcmp(l + step.offset, r + step.offset, step.size)) return false;
+		}
+		else if (!step.info->equals(l + step.offset, r + step.offset)) return false;
+	}
+	return true;
+}
+
+size_t RTTR::hashMembers(const RTTRInfo& info, const void* o)
+{
+	return hashMembers(info.plan<ValuePlan>(&ValuePlan::build), o);
+}
+
+size_t RTTR::hashMembers(const ValuePlan& plan, const void* o)
+{
+	assert(o != nullptr);
+
+	if (plan.steps.empty())
+	{
+		assert(false && "The type has no registered normal members, no std::hash and is not bytewise hashable");
+		return std::hash<const void*>{}(o);
+	}
+
+	auto object{ static_cast<const unsigned char*>(o) };
+	if (plan.bytewise) return hashBytes(object, plan.steps[0].size);
+
+	size_t seed{ 0 };
+	for (const auto& step : plan.steps)
+		seed = hashCombine(seed, nullptr == step.info ? hashBytes(object + step.offset, step.size) : step.info->hash(object + step.offset));
+	return seed;
+}
+
+bool RTTR::copyMembers(const RTTRInfo& info, void* o, const void* value)
+{
+	assert(o != nullptr && value != nullptr);
+
+	const auto& plan{ info.plan<ValuePlan>(&ValuePlan::build) };
+	auto to{ static_cast<unsigned char*>(o) };
+	auto from{ static_cast<const unsigned char*>(value) };
+	for (const auto& step : plan.steps)
+	{
+		if (nullptr == step.info) std::memcpy(to + step.offset, from + step.offset, step.size);
+		else if (!step.info->copyAssign(to + step.offset, from + step.offset)) return false;
+	}
+	return true;
+}
+
+void* RTTR::clone(const RTTRInfo& info, const void* o)
+{
+	assert(o != nullptr);
+
+	auto memory{ info.allocate() };
+	if (nullptr == memory) return nullptr;
+
+	if (info.trivial())
+	{
+		std::memcpy(memory, o, info.size());
+		return memory;
+	}
+	if (info.copyConstruct(memory, o)) return memory;
+
+	info.deallocate(memory);
+	return nullptr;
+}
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "RTTRInfo/RTTRInfo.h"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ϲϣֵ˳й
+	/// </summary>
+	inline size_t hashCombine(size_t seed, size_t value)
+	{
+		return seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+	}
+
+	/// <summary>
+	/// ֽڼϣֵ
+	/// </summary>
+	inline size_t hashBytes(const void* data, size_t size)
+	{
+		return std::hash<std::string_view>{}({ static_cast<const char*>(data), size });
+	}
+
+	/// <summary>
+	/// ֵƻƫͨԱɶλԱڵĿɰֽڱȽϵĳԱϲΪһ
+	/// Ƚϡϣ븴ʱmemcmp/ֽڹϣ/memcpyֻԱϢ
+	/// ԱͿƽơעͨԱЩԱܸʱҲڵĶ
+	/// </summary>
+	struct ValuePlan
+	{
+	public:
+		struct Step
+		{
+		public:
+			int offset;
+			size_t size;				//infoΪnullptrʱΪεֽ
+			const RTTRInfo* info;		//ֽܰڴĳԱϢݹ鴦
+		};
+
+	public:
+		/// <summary>
+		/// Ϣֵƻ
+		/// ûעͨԱbytewise()ʱΪһΣƻΪ
+		/// ƻ״ʹʱ˺Ǽǵĸ಻Ტ
+		/// </summary>
+		/// <param name="info"></param>
+		/// <returns></returns>
+		static ValuePlan build(const RTTRInfo& info);
+
+	public:
+		std::vector<Step> steps{};
+		bool bytewise{ false };			//ֻһҸ
+	};
+
+	/// <summary>
+	/// ֵƻȽͨԱ
+	/// ƻΪ˵޷ֵȽϣʧܣ汾аַȽ
+	/// </summary>
+	bool equalMembers(const RTTRInfo& info, const void* lhs, const void* rhs);
+	bool equalMembers(const ValuePlan& plan, const void* lhs, const void* rhs);
+
+	/// <summary>
+	/// ֵƻͨԱĹϣֵ
+	/// ƻΪʱʧܣ汾зصַĹϣֵ
+	/// </summary>
+	size_t hashMembers(const RTTRInfo& info, const void* o);
+	size_t hashMembers(const ValuePlan& plan, const void* o);
+
+	/// <summary>
+	/// ֵƻvalueͨԱƵѹĶoƽԱ͵ĸƸֵд
+	/// </summary>
+	/// <returns>гԱɸƸֵʱfalseʱoڲָƵ״̬</returns>
+	bool copyMembers(const RTTRInfo& info, void* o, const void* value);
+
+	/// <summary>
+	/// 䲢ƹһ󣬿ƽƵmemcpyʹ临ƹ캯
+	/// ƹ캯ƶ󣬰δעĳԱ˲Ա
+	/// </summary>
+	/// <param name="info">Ϣ</param>
+	/// <param name="o">Դ</param>
+	/// <returns>ͲɸʱnullptrصĶinfo.destroy()</returns>
+	void* clone(const RTTRInfo& info, const void* o);
+
+	/// <summary>
+	/// TıȽϣ
+	/// ͵ֵֽڴ(long double)Ϣֵƻ׼·ػ
+	/// ɰֽڱȽϵֵȽϵλģʽ+0.0-0.0ȣͬλģʽNaN
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
+	template<typename T>
+	struct ValueCodec
+	{
+	public:
+		static constexpr bool leaf{ !std::is_class_v<T> };
+
+	public:
+		static bool equals(const T& lhs, const T& rhs)
+		{
+			if constexpr (leaf && bytewise<T>()) return 0 == std::memcmp(&lhs, &rhs, sizeof(T));
+			else if constexpr (leaf) return lhs == rhs;
+			else return RealRTTRInfo<T>::instance()->equals(&lhs, &rhs);
+		}
+
+		static size_t hash(const T& value)
+		{
+			if constexpr (leaf && bytewise<T>()) return hashBytes(&value, sizeof(T));
+			else if constexpr (leaf) return std::hash<T>{}(value);
+			else return RealRTTRInfo<T>::instance()->hash(&value);
+		}
+	};
+
+	template<>
+	struct ValueCodec<std::string>
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+	public:
+		static bool equals(const std::string& lhs, const std::string& rhs) { return lhs == rhs; }
+		static size_t hash(const std::string& value) { return std::hash<std::string>{}(value); }
+	};
+
+	/// <summary>
+	/// ˳ȽϵԪؿɰֽڱȽϵαȽ
+	/// </summary>
+	template<typename C>
+	struct ValueSequenceCodec
+	{
+	public:
+		using E = typename C::value_type;
+
+		static constexpr bool leaf{ true };
+		static constexpr bool contiguous{ bytewise<E>() && requires(const C& value) { value.data(); } };
+
+	public:
+		static bool equals(const C& lhs, const C& rhs)
+		{
+			if (lhs.size() != rhs.size()) return false;
+			if constexpr (contiguous) return lhs.empty() || 0 == std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(E));
+			else return std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](const E& l, const E& r) { return ValueCodec<E>::equals(l, r); });
+		}
+
+		static size_t hash(const C& value)
+		{
+			if constexpr (contiguous) return hashCombine(value.size(), hashBytes(value.data(), value.size() * sizeof(E)));
+			else
+			{
+				size_t seed{ value.size() };
+				for (const auto& element : value) seed = hashCombine(seed, ValueCodec<E>::hash(element));
+				return seed;
+			}
+		}
+	};
+
+	/// <summary>
+	/// һԪرȽϣϣֵ˳޹
+	/// </summary>
+	template<typename C>
+	struct ValueUnorderedCodec
+	{
+	public:
+		static constexpr bool leaf{ true };
+
+	public:
+		static bool equals(const C& lhs, const C& rhs)
+		{
+			if (lhs.size() != rhs.size()) return false;
+
+			for (const auto& element : lhs)
+			{
+				if constexpr (requires { typename C::mapped_type; })
+				{
+					auto found{ rhs.find(element.first) };
+					if (found == rhs.end() || !ValueCodec<typename C::mapped_type>::equals(element.second, found->second)) return false;
+				}
+				else
+				{
+					auto found{ rhs.find(element) };
+					if (found == rhs.end() || !ValueCodec<typename C::value_type>::equals(element, *found)) return false;
+				}
+			}
+			return true;
+		}
+
+		static size_t hash(const C& value)
+		{
+			size_t sum{ 0 };
+			for (const auto& element : value)
+			{
+				if constexpr (requires { typename C::mapped_type; })
+					sum += hashCombine(ValueCodec<typename C::key_type>::hash(element.first), ValueCodec<typename C::mapped_type>::hash(element.second));
+				else
+					sum += ValueCodec<typename C::value_type>::hash(element);
+			}
+			return hashCombine(value.size(), sum);
+		}
+	};
+
+	template<typename F, typename S>
+	struct ValueCodec<std::pair<F, S>>
+	{
+	public:
+		using First = std::remove_const_t<F>;
+
+		static constexpr bool leaf{ true };
+
+	public:
+		static bool equals(const std::pair<F, S>& lhs, const std::pair<F, S>& rhs)
+		{
+			return ValueCodec<First>::equals(lhs.first, rhs.first) && ValueCodec<S>::equals(lhs.second, rhs.second);
+		}
+
+		static size_t hash(const std::pair<F, S>& value)
+		{
+			return hashCombine(ValueCodec<First>::hash(value.first), ValueCodec<S>::hash(value.second));
+		}
+	};
+
+	template<typename E, typename A>
+	struct ValueCodec<std::vector<E, A>> : ValueSequenceCodec<std::vector<E, A>> {};
+
+	template<typename E, typename A>
+	struct ValueCodec<std::deque<E, A>> : ValueSequenceCodec<std::deque<E, A>> {};
+
+	template<typename E, typename A>
+	struct ValueCodec<std::list<E, A>> : ValueSequenceCodec<std::list<E, A>> {};
+
+	template<typename E, size_t N>
+	struct ValueCodec<std::array<E, N>> : ValueSequenceCodec<std::array<E, N>> {};
+
+	template<typename E, typename P, typename A>
+	struct ValueCodec<std::set<E, P, A>> : ValueSequenceCodec<std::set<E, P, A>> {};
+
+	template<typename K, typename V, typename P, typename A>
+	struct ValueCodec<std::map<K, V, P, A>> : ValueSequenceCodec<std::map<K, V, P, A>> {};
+
+	template<typename E, typename H, typename P, typename A>
+	struct ValueCodec<std::unordered_set<E, H, P, A>> : ValueUnorderedCodec<std::unordered_set<E, H, P, A>> {};
+
+	template<typename K, typename V, typename H, typename P, typename A>
+	struct ValueCodec<std::unordered_map<K, V, H, P, A>> : ValueUnorderedCodec<std::unordered_map<K, V, H, P, A>> {};
+
+	/// <summary>
+	/// RealRTTRInfo<T>::equalsʵ
+	/// ҶֱӱȽϣעͨԱͰֵƻȽϣûעʱʹToperator==
+	/// </summary>
+	template<typename T>
+	static bool equalsObject(const RTTRInfo& info, const void* lhs, const void* rhs)
+	{
+		if constexpr (std::is_void_v<T>) return true;
+		else if constexpr (ValueCodec<T>::leaf) return ValueCodec<T>::equals(*static_cast<const T*>(lhs), *static_cast<const T*>(rhs));
+		else
+		{
+			const auto& plan{ info.plan<ValuePlan>(&ValuePlan::build) };
+			if constexpr (requires(const T& value) { { value == value } -> std::convertible_to<bool>; })
+			{
+				if (plan.steps.empty()) return *static_cast<const T*>(lhs) == *static_cast<const T*>(rhs);
+			}
+			return equalMembers(plan, lhs, rhs);
+		}
+	}
+
+	/// <summary>
+	/// RealRTTRInfo<T>::hashʵ
+	/// עͨԱͰֵƻ㣬ûעʱʹstd::hash<T>
+	/// </summary>
+	template<typename T>
+	static size_t hashObject(const RTTRInfo& info, const void* o)
+	{
+		if constexpr (std::is_void_v<T>) return 0;
+		else if constexpr (ValueCodec<T>::leaf) return ValueCodec<T>::hash(*static_cast<const T*>(o));
+		else
+		{
+			const auto& plan{ info.plan<ValuePlan>(&ValuePlan::build) };
+			if constexpr (requires(const T& value) { { std::hash<T>{}(value) } -> std::convertible_to<size_t>; })
+			{
+				if (plan.steps.empty()) return std::hash<T>{}(*static_cast<const T*>(o));
+			}
+			return hashMembers(plan, o);
+		}
+	}
+
+	/// <summary>
+	/// Ƚֵ
+	/// </summary>
+	template<typename T>
+	static bool equals(const T& lhs, const T& rhs) { return ValueCodec<T>::equals(lhs, rhs); }
+
+	/// <summary>
+	/// ֵĹϣֵ
+	/// </summary>
+	template<typename T>
+	static size_t hash(const T& value) { return ValueCodec<T>::hash(value); }
+
+	/// <summary>
+	/// 䲢һ
+	/// </summary>
+	/// <returns>صĶRealRTTRInfo<T>::instance()->destroy()</returns>
+	template<typename T>
+	static T* clone(const T& value) { return static_cast<T*>(clone(*RealRTTRInfo<T>::instance(), &value)); }
+
+	/// <summary>
+	/// RTTR::hashΪϣĹϣstd::unordered_set<T, RTTR::ValueHash<T>, RTTR::ValueEqual<T>>
+	/// </summary>
+	template<typename T>
+	struct ValueHash
+	{
+	public:
+		size_t operator ()(const T& value) const { return ValueCodec<T>::hash(value); }
+	};
+
+	/// <summary>
+	/// RTTR::equalsΪϣıȽϺ
+	/// </summary>
+	template<typename T>
+	struct ValueEqual
+	{
+	public:
+		bool operator ()(const T& lhs, const T& rhs) const { return ValueCodec<T>::equals(lhs, rhs); }
+	};
+}
@@ -0,0 +1,318 @@
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "RTTRVariant.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// ѲƻתΪҪͣ޸Ļֱ߲Ӵ÷const
+	/// </summary>
+	/// <param name="method"></param>
+	/// <param name="args">ͨaccepts</param>
+	/// <param name="pointers">ָ룬args.size()</param>
+	/// <param name="converted">ƻתʱֵargs.size()</param>
+	static void bindArgs(const MethodInfo& method, std::span<const Variant> args, void** pointers, Variant* converted)
+	{
+		for (size_t i = 0; i < args.size(); ++i)
+		{
+			converted[i] = args[i].convert(method.args[i]);
+			pointers[i] = converted[i].data();
+		}
+	}
+
+	/// <summary>
+	/// вܽܲķȾȷƥת
+	/// </summary>
+	/// <param name="overloads"></param>
+	/// <param name="args"></param>
+	/// <param name="exact"></param>
+	/// <returns>Ҳʱnullptr</returns>
+	template<typename T>
+	static const MethodInfo* match(std::span<const T* const> overloads, std::span<const Variant> args, bool exact)
+	{
+		for (auto method : overloads)
+			if (method->accepts(args, exact)) return method;
+		return nullptr;
+	}
+
+	/// <summary>
+	/// Variantֵaddressinfo͵ֵconstvalueƶֵ
+	/// </summary>
+	/// <param name="info">ֵ</param>
+	/// <param name="address"></param>
+	/// <param name="value"></param>
+	/// <returns></returns>
+	template<typename V>
+	static bool assign(const RTTRInfo* info, void* address, V& value)
+	{
+		if (value.info() == info)
+		{
+			if constexpr (std::is_const_v<V>) return info->copyAssign(address, value.data());
+			else return info->moveAssign(address, value.data());
+		}
+
+		//תֵƽƣֱӸ
+		return convertArithmetic(value.info(), value.data(), info, address);
+	}
+
+	/// <summary>
+	/// ֲҳԱֵ
+	/// </summary>
+	template<typename V>
+	static bool assignMember(void* o, std::string_view name, std::string_view member, V& value)
+	{
+		auto info{ RTTRInfo::info(name) };
+		if (nullptr == info) return false;
+
+		if (o)
+		{
+			auto normal{ info->inheritedNormalMember(member) };
+			if (auto owner{ normal ? normal.adjust(o) : nullptr })
+			{
+				if (!assign(normal.info->info, static_cast<unsigned char*>(owner) + normal.info->offset, value)) return false;
+
+				//óԱλ
+				normal.info->markDirty(owner);
+				return true;
+			}
+		}
+
+		auto find{ info->inheritedStaticMember(member) };
+		return find && assign(find.info->info, const_cast<void*>(find.info->address), value);
+	}
+}
+
+RTTR::Variant::Variant(const Variant& other)
+{
+	if (other.empty()) return;
+
+	if (other.m_trivial && !other.m_heap)
+	{
+		std::memcpy(m_buffer, other.m_buffer, InlineSize);
+		m_info = other.m_info;
+		m_trivial = true;
+		return;
+	}
+
+	[[maybe_unused]] auto copied{ emplace(other.m_info, [&other](void* memory)
+		{
+			if (other.m_trivial)
+			{
+				std::memcpy(memory, other.data(), other.m_info->size());
+				return true;
+			}
+			return other.m_info->copyConstruct(memory, other.data());
+		}) };
+	assert(copied && "Variant holds a type that is not copy constructible");
+}
+
+RTTR::Variant::Variant(Variant&& other) noexcept
+{
+	moveFrom(other);
+}
+
+RTTR::Variant& RTTR::Variant::operator =(const Variant& other)
+{
+	if (this != &other)
+	{
+		Variant copy{ other };
+		reset();
+		moveFrom(copy);
+	}
+	return *this;
+}
+
+RTTR::Variant& RTTR::Variant::operator =(Variant&& other) noexcept
+{
+	if (this != &other)
+	{
+		reset();
+		moveFrom(other);
+	}
+	return *this;
+}
+
+void RTTR::Variant::moveFrom(Variant& other) noexcept
+{
+	assert(empty());
+	if (other.empty()) return;
+
+	if (other.m_heap) m_pointer = other.m_pointer;
+	else if (other.m_trivial) std::memcpy(m_buffer, other.m_buffer, InlineSize);
+	else
+	{
+		[[maybe_unused]] auto moved{ other.m_info->moveConstruct(m_buffer, other.m_buffer) || other.m_info->copyConstruct(m_buffer, other.m_buffer) };
+		assert(moved && "Variant holds a type that is neither movable nor copyable");
+		other.m_info->destruct(other.m_buffer);
+	}
+
+	m_info = other.m_info;
+	m_heap = other.m_heap;
+	m_trivial = other.m_trivial;
+	other.m_info = nullptr;
+	other.m_heap = false;
+}
+
+RTTR::Variant RTTR::Variant::convert(const RTTRInfo* target) const
+{
+	if (target == m_info) return *this;
+
+	Variant converted{};
+	if (target && !empty()) converted.emplace(target, [this, target](void* memory) { return convertArithmetic(m_info, data(), target, memory); });
+	return converted;
+}
+
+void RTTR::Variant::reset()
+{
+	if (empty()) return;
+
+	if (!m_trivial) m_info->destruct(data());
+	release(m_info);
+	m_info = nullptr;
+}
+
+void* RTTR::Variant::prepare(const RTTRInfo* info)
+{
+	auto size{ info->size() };
+	m_trivial = 0 == size || info->trivial();
+	m_heap = size > InlineSize || info->alignment() > alignof(std::max_align_t);
+	if (!m_heap) return m_buffer;
+
+	m_pointer = info->allocate();
+	return m_pointer;
+}
+
+void RTTR::Variant::release(const RTTRInfo* info)
+{
+	if (m_heap) info->deallocate(m_pointer);
+	m_heap = false;
+}
+
+bool RTTR::MethodInfo::accepts(std::span<const Variant> args, bool exact) const
+{
+	if (args.size() != this->args.size()) return false;
+
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		if (args[i].info() == this->args[i]) continue;
+		if (exact || !isArithmetic(args[i].info()) || !isArithmetic(this->args[i])) return false;
+	}
+	return true;
+}
+
+RTTR::Variant RTTR::MethodInfo::call(void* self, std::span<const Variant> args) const
+{
+	Variant result{};
+	if (!accepts(args, false)) return result;
+
+	//ʱָתʱֵջ
+	void* inlinePointers[Variant::InlineArgs];
+	Variant inlineConverted[Variant::InlineArgs];
+	std::vector<void*> pointers{};
+	std::vector<Variant> converted{};
+	auto argPointers{ inlinePointers };
+	auto argConverted{ inlineConverted };
+	if (args.size() > Variant::InlineArgs)
+	{
+		pointers.resize(args.size());
+		converted.resize(args.size());
+		argPointers = pointers.data();
+		argConverted = converted.data();
+	}
+	bindArgs(*this, args, argPointers, argConverted);
+
+	result.emplace(returnInfo, [this, self, argPointers](void* memory)
+		{
+			call(self, argPointers, memory);
+			return true;
+		});
+	return result;
+}
+
+RTTR::Variant RTTR::StaticMemberInfo::get() const
+{
+	Variant value{};
+	value.emplace(info, [this](void* memory) { return info->copyConstruct(memory, address); });
+	return value;
+}
+
+bool RTTR::StaticMemberInfo::set(const Variant& value) const
+{
+	return assign(info, const_cast<void*>(address), value);
+}
+
+bool RTTR::StaticMemberInfo::set(Variant&& value) const
+{
+	return assign(info, const_cast<void*>(address), value);
+}
+
+RTTR::Variant RTTR::NormalMemberInfo::get(const void* o) const
+{
+	assert(o != nullptr);
+
+	Variant value{};
+	value.emplace(info, [this, o](void* memory) { return info->copyConstruct(memory, static_cast<const unsigned char*>(o) + offset); });
+	return value;
+}
+
+bool RTTR::NormalMemberInfo::set(void* o, const Variant& value) const
+{
+	assert(o != nullptr);
+	if (!assign(info, static_cast<unsigned char*>(o) + offset, value)) return false;
+
+	markDirty(o);
+	return true;
+}
+
+bool RTTR::NormalMemberInfo::set(void* o, Variant&& value) const
+{
+	assert(o != nullptr);
+	if (!assign(info, static_cast<unsigned char*>(o) + offset, value)) return false;
+
+	markDirty(o);
+	return true;
+}
+
+RTTR::Variant RTTR::invokeMethod(void* o, std::string_view name, std::string_view method, std::span<const Variant> args)
+{
+	auto info{ RTTRInfo::info(name) };
+	if (nullptr == info) throw std::bad_function_call{};
+
+	for (auto exact : { true, false })
+	{
+		const MethodInfo* found{ match(info->staticMethod(method), args, exact) };
+		if (nullptr == found && o) found = match(info->normalMethod(method), args, exact);
+		if (nullptr == found && o) found = match(info->constMethod(method), args, exact);
+		if (found) return found->call(o, args);
+	}
+
+	RTTR_PROFILE_MISS(info);
+	throw std::bad_function_call{};
+}
+
+RTTR::Variant RTTR::getMember(const void* o, std::string_view name, std::string_view member)
+{
+	auto info{ RTTRInfo::info(name) };
+	if (nullptr == info) return {};
+
+	if (o)
+	{
+		auto normal{ info->inheritedNormalMember(member) };
+		if (normal && normal.adjust(o)) return normal.info->get(normal.adjust(o));
+	}
+
+	auto find{ info->inheritedStaticMember(member) };
+	return find ? find.info->get() : Variant{};
+}
+
+bool RTTR::setMember(void* o, std::string_view name, std::string_view member, const Variant& value)
+{
+	return assignMember(o, name, member, value);
+}
+
+bool RTTR::setMember(void* o, std::string_view name, std::string_view member, Variant&& value)
+{
+	return assignMember(o, name, member, value);
+}
@@ -0,0 +1,322 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "RTTRRegister/RTTRBuiltin.hpp"
+
+namespace RTTR
+{
+	/// <summary>
+	/// Ϣѡ
+	/// </summary>
+	/// <param name="info"></param>
+	/// <param name="visitor">ԶӦ͵Ŀָãʱvoid*</param>
+	/// <returns></returns>
+	template<typename Visitor>
+	static auto visitArithmetic(const RTTRInfo* info, Visitor visitor)
+	{
+		switch (info ? info->id() : 0)
+		{
+		case RealRTTRInfo<bool>::typeId: return visitor(static_cast<bool*>(nullptr));
+		case RealRTTRInfo<char>::typeId: return visitor(static_cast<char*>(nullptr));
+		case RealRTTRInfo<signed char>::typeId: return visitor(static_cast<signed char*>(nullptr));
+		case RealRTTRInfo<unsigned char>::typeId: return visitor(static_cast<unsigned char*>(nullptr));
+		case RealRTTRInfo<short>::typeId: return visitor(static_cast<short*>(nullptr));
+		case RealRTTRInfo<unsigned short>::typeId: return visitor(static_cast<unsigned short*>(nullptr));
+		case RealRTTRInfo<int>::typeId: return visitor(static_cast<int*>(nullptr));
+		case RealRTTRInfo<unsigned int>::typeId: return visitor(static_cast<unsigned int*>(nullptr));
+		case RealRTTRInfo<long>::typeId: return visitor(static_cast<long*>(nullptr));
+		case RealRTTRInfo<unsigned long>::typeId: return visitor(static_cast<unsigned long*>(nullptr));
+		case RealRTTRInfo<long long>::typeId: return visitor(static_cast<long long*>(nullptr));
+		case RealRTTRInfo<unsigned long long>::typeId: return visitor(static_cast<unsigned long long*>(nullptr));
+		case RealRTTRInfo<float>::typeId: return visitor(static_cast<float*>(nullptr));
+		case RealRTTRInfo<double>::typeId: return visitor(static_cast<double*>(nullptr));
+		default: return visitor(static_cast<void*>(nullptr));
+		}
+	}
+
+	/// <summary>
+	/// ǷΪõ
+	/// </summary>
+	/// <param name="info"></param>
+	/// <returns></returns>
+	inline bool isArithmetic(const RTTRInfo* info)
+	{
+		return visitArithmetic(info, []<typename T>(T*) { return !std::is_void_v<T>; });
+	}
+
+	/// <summary>
+	/// memoryvalue(from)תõto͵ֵ
+	/// </summary>
+	/// <returns>һͲʱfalse</returns>
+	inline bool convertArithmetic(const RTTRInfo* from, const void* value, const RTTRInfo* to, void* memory)
+	{
+		return visitArithmetic(from, [value, to, memory]<typename F>(F*)
+			{
+				if constexpr (std::is_void_v<F>) return false;
+				else return visitArithmetic(to, [source{ *static_cast<const F*>(value) }, memory]<typename T>(T*)
+					{
+						if constexpr (std::is_void_v<T>) return false;
+						else
+						{
+							new (memory) T(static_cast<T>(source));
+							return true;
+						}
+					});
+			});
+	}
+
+	/// <summary>
+	/// Ϣֵڶ̬õĲ뷵ֵ
+	/// СInlineSizeҶ벻max_align_tֵڲ͵allocate()䣬öʱӳз
+	/// ƽƵֵֽڸƣƶʱϵֵֻתָ룬ڲֵ͵ƶ죬ƶ첻Ӧ׳쳣
+	/// </summary>
+	class Variant
+	{
+	public:
+		/// <summary>
+		/// ڲ洢ĴСstd::string뼸ֶεСṹ
+		/// </summary>
+		static constexpr size_t InlineSize{ 48 };
+
+		/// <summary>
+		/// MethodInfo::callڴ
+		/// </summary>
+		static constexpr size_t InlineArgs{ 8 };
+
+		/// <summary>
+		/// ֵTĴ洢ַͣconst char*Ϊstd::string
+		/// </summary>
+		template<typename T>
+		using stored_t = std::conditional_t<std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>, std::string, std::remove_cvref_t<T>>;
+
+		/// <summary>
+		/// Tܷڲ
+		/// </summary>
+		template<typename T>
+		static constexpr bool fitsInline{ sizeof(T) <= InlineSize && alignof(T) <= alignof(std::max_align_t) };
+
+	public:
+		Variant() = default;
+
+		/// <summary>
+		/// ֵ죬Tע
+		/// </summary>
+		/// <param name="value">ֵƶ</param>
+		template<typename T> requires (!std::is_same_v<std::remove_cvref_t<T>, Variant> && requires { RealRTTRInfo<stored_t<T>>::instance(); })
+		Variant(T&& value)
+		{
+			emplace<stored_t<T>>(std::forward<T>(value));
+		}
+
+		Variant(const Variant& other);
+		Variant(Variant&& other) noexcept;
+		Variant& operator =(const Variant& other);
+		Variant& operator =(Variant&& other) noexcept;
+		~Variant() { reset(); }
+
+	public:
+		explicit operator bool() const { return m_info != nullptr; }
+
+		/// <summary>
+		/// ǷΪգ̬ʧʱؿյVariant
+		/// </summary>
+		/// <returns></returns>
+		bool empty() const { return m_info == nullptr; }
+
+		/// <summary>
+		/// ֵͣvoidķֵΪvoidϢ
+		/// </summary>
+		/// <returns>Ϊʱnullptr</returns>
+		const RTTRInfo* info() const { return m_info; }
+
+		/// <summary>
+		/// ֵĵַ
+		/// </summary>
+		/// <returns></returns>
+		void* data() { return m_heap ? m_pointer : m_buffer; }
+		const void* data() const { return m_heap ? m_pointer : m_buffer; }
+
+		/// <summary>
+		/// ֵǷΪT
+		/// </summary>
+		template<typename T>
+		bool is() const { return isType<T>(m_info); }
+
+		/// <summary>
+		/// Tȡֵ
+		/// </summary>
+		/// <returns>Ͳʱnullptr</returns>
+		template<typename T>
+		T* get() { return is<T>() ? static_cast<T*>(data()) : nullptr; }
+
+		template<typename T>
+		const T* get() const { return is<T>() ? static_cast<const T*>(data()) : nullptr; }
+
+		/// <summary>
+		/// Tȡֵ֮䰴static_castת
+		/// </summary>
+		/// <param name="out"></param>
+		/// <returns>Ͳ޷תʱfalse</returns>
+		template<typename T>
+		bool to(T& out) const
+		{
+			if (auto value{ get<T>() })
+			{
+				out = *value;
+				return true;
+			}
+
+			if constexpr (std::is_arithmetic_v<T>) return convertArithmetic(m_info, data(), RealRTTRInfo<T>::instance(), &out);
+			else return false;
+		}
+
+		/// <summary>
+		/// תΪtargetͣͬʱ
+		/// </summary>
+		/// <param name="target"></param>
+		/// <returns>޷תʱΪ</returns>
+		Variant convert(const RTTRInfo* target) const;
+
+		/// <summary>
+		/// ԲT͵ֵ滻ԭеֵ
+		/// </summary>
+		/// <returns>µֵ</returns>
+		template<typename T, typename... Args>
+		T& emplace(Args&&... args)
+		{
+			reset();
+
+			auto info{ RealRTTRInfo<T>::instance() };
+			void* memory{ m_buffer };
+			if constexpr (!fitsInline<T>) memory = info->allocate();
+
+			try
+			{
+				new (memory) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				if constexpr (!fitsInline<T>) info->deallocate(memory);
+				throw;
+			}
+
+			if constexpr (!fitsInline<T>) m_pointer = memory;
+			m_info = info;
+			m_heap = !fitsInline<T>;
+			m_trivial = std::is_trivially_copyable_v<T>;
+			return *static_cast<T*>(memory);
+		}
+
+		/// <summary>
+		/// info͹ֵ滻ԭеֵ
+		/// </summary>
+		/// <param name="info">ֵ</param>
+		/// <param name="construct">construct(memory)δʼĴ洢Ϲ󣬷Ƿɹ</param>
+		/// <returns>ʧʱΪղfalse</returns>
+		template<typename Construct>
+		bool emplace(const RTTRInfo* info, Construct&& construct)
+		{
+			assert(info != nullptr);
+			reset();
+
+			auto memory{ prepare(info) };
+			bool constructed{ false };
+			try
+			{
+				constructed = construct(memory);
+			}
+			catch (...)
+			{
+				release(info);
+				throw;
+			}
+
+			if (!constructed)
+			{
+				release(info);
+				return false;
+			}
+			m_info = info;
+			return true;
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		void reset();
+
+	private:
+		/// <summary>
+		/// Ϊinfo׼δʼĴ洢ô洢ʽ
+		/// </summary>
+		void* prepare(const RTTRInfo* info);
+
+		/// <summary>
+		/// ͷprepare()׼Ĵ洢ֵδ
+		/// </summary>
+		void release(const RTTRInfo* info);
+
+		/// <summary>
+		/// other룬ǰΪ
+		/// </summary>
+		void moveFrom(Variant& other) noexcept;
+
+	private:
+		union
+		{
+			alignas(std::max_align_t) unsigned char m_buffer[InlineSize];
+			void* m_pointer;
+		};
+		const RTTRInfo* m_info{ nullptr };
+		bool m_heap{ false };				//ֵڶϣm_pointerЧ
+		bool m_trivial{ false };			//ֵƽƣƶʱֽڸ
+	};
+
+	/// <summary>
+	/// ʵ͵÷
+	/// ھ̬ͨconstвҲһµأûʱܰת
+	/// </summary>
+	/// <param name="o">ΪnullptrʱֻҾ̬</param>
+	/// <param name="name"></param>
+	/// <param name="method"></param>
+	/// <param name="args"></param>
+	/// <returns>voidسvoidVariantͻƥزʱ׳std::bad_function_call</returns>
+	Variant invokeMethod(void* o, std::string_view name, std::string_view method, std::span<const Variant> args);
+
+	/// <summary>
+	/// ʵ͵÷װΪVariant
+	/// </summary>
+	template<typename... Args> requires (std::is_constructible_v<Variant, Args> && ...)
+	static Variant invokeMethod(void* o, std::string_view name, std::string_view method, Args&&... args)
+	{
+		const std::array<Variant, sizeof...(Args)> values{ Variant{ std::forward<Args>(args) }... };
+		return invokeMethod(o, name, method, std::span<const Variant>{ values });
+	}
+
+	/// <summary>
+	/// ֻȡԱֵȲͨԱٲҾ̬ԱͨԱؼ̳йϵ
+	/// </summary>
+	/// <param name="o">ΪnullptrʱֻҾ̬Ա</param>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <returns>ͻԱʱΪ</returns>
+	Variant getMember(const void* o, std::string_view name, std::string_view member);
+
+	/// <summary>
+	/// óԱֵͲͬʱת
+	/// </summary>
+	/// <param name="o">ΪnullptrʱֻҾ̬Ա</param>
+	/// <param name="name"></param>
+	/// <param name="member">Ա</param>
+	/// <param name="value">ֵƶֵд</param>
+	/// <returns>ͻԱڡͲ޷תʱfalse</returns>
+	bool setMember(void* o, std::string_view name, std::string_view member, const Variant& value);
+	bool setMember(void* o, std::string_view name, std::string_view member, Variant&& value);
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace RTTRBenchmark
+{
+	/// <summary>
+	/// ׼ĽʱΪÿεõ
+	/// </summary>
+	struct Result
+	{
+		std::string name;
+		size_t iterations;
+		std::vector<double> samples;
+		size_t sink;
+
+		double median() const
+		{
+			auto sorted{ samples };
+			std::sort(sorted.begin(), sorted.end());
+			return sorted[sorted.size() / 2];
+		}
+
+		double min() const { return *std::min_element(samples.begin(), samples.end()); }
+		double max() const { return *std::max_element(samples.begin(), samples.end()); }
+	};
+
+	/// <summary>
+	/// в
+	/// </summary>
+	struct Options
+	{
+		std::string filter{};
+		std::string out{};
+		bool json{ false };
+		bool list{ false };
+		size_t repetitions{ 5 };
+		double scale{ 1.0 };
+
+		/// <summary>
+		/// У--filter=Ӵ --format=console|json --out=ļ --repetitions=N --scale= --list
+		/// </summary>
+		/// <returns>޷ʶʱfalse</returns>
+		bool parse(int argc, char** argv)
+		{
+			for (int i = 1; i < argc; ++i)
+			{
+				std::string_view arg{ argv[i] };
+				auto value{ [arg](std::string_view key) { return arg.substr(key.size()); } };
+				if (arg.starts_with("--filter=")) filter = value("--filter=");
+				else if (arg == "--format=json") json = true;
+				else if (arg == "--format=console") json = false;
+				else if (arg.starts_with("--out=")) out = value("--out=");
+				else if (arg.starts_with("--repetitions=")) repetitions = std::max<size_t>(1, std::stoul(std::string{ value("--repetitions=") }));
+				else if (arg.starts_with("--scale=")) scale = std::stod(std::string{ value("--scale=") });
+				else if (arg == "--list") list = true;
+				else return false;
+			}
+			return true;
+		}
+	};
+
+	/// <summary>
+	/// ׼
+	/// ÿ׼repetitionsظУÿظǰsetup׼״̬(ʱ)bodyڲiterationsε
+	/// </summary>
+	class Suite
+	{
+	public:
+		/// <summary>
+		/// ӿظõĻ׼
+		/// </summary>
+		/// <param name="func">func(i)ֵۼԷŻ</param>
+		template<typename Func>
+		void add(std::string name, size_t iterations, Func func)
+		{
+			add(std::move(name), iterations, [](size_t) {}, std::move(func));
+		}
+
+		/// <summary>
+		/// Ҫ׼״̬Ļ׼ÿظҪµעĿ
+		/// </summary>
+		/// <param name="setup">setup(iterations)</param>
+		/// <param name="func">func(i)</param>
+		template<typename Setup, typename Func>
+		void add(std::string name, size_t iterations, Setup setup, Func func)
+		{
+			m_cases.push_back({ std::move(name), iterations, std::move(setup), [func](size_t iterations) mutable
+				{
+					size_t sink{ 0 };
+					for (size_t i = 0; i < iterations; ++i) sink += func(i);
+					return sink;
+				} });
+		}
+
+		/// <summary>
+		/// ʱĻ׼һôiterations󣬽԰ÿ
+		/// </summary>
+		/// <param name="setup">setup(iterations)</param>
+		/// <param name="func">func(iterations)һȫ</param>
+		template<typename Setup, typename Func>
+		void addBulk(std::string name, size_t iterations, Setup setup, Func func)
+		{
+			m_cases.push_back({ std::move(name), iterations, std::move(setup), std::move(func) });
+		}
+
+		/// <summary>
+		/// ưfilterĻ׼
+		/// </summary>
+		std::vector<Result> run(const Options& options) const
+		{
+			std::vector<Result> results{};
+			for (const auto& c : m_cases)
+			{
+				if (c.name.find(options.filter) == std::string::npos) continue;
+
+				auto iterations{ std::max<size_t>(1, static_cast<size_t>(c.iterations * options.scale)) };
+				Result result{ c.name, iterations, {}, 0 };
+				for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+				{
+					c.setup(iterations);
+					auto begin{ std::chrono::steady_clock::now() };
+					result.sink += c.body(iterations);
+					auto end{ std::chrono::steady_clock::now() };
+					result.samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / iterations);
+				}
+				if (!options.json) std::printf("%-56s %12.2f ns %12.2f ns %10zu\n", result.name.c_str(), result.median(), result.min(), result.iterations);
+				results.push_back(std::move(result));
+			}
+			return results;
+		}
+
+		/// <summary>
+		/// ȫ׼
+		/// </summary>
+		std::vector<std::string> names() const
+		{
+			std::vector<std::string> names{};
+			for (const auto& c : m_cases) names.push_back(c.name);
+			return names;
+		}
+
+	private:
+		struct Case
+		{
+			std::string name;
+			size_t iterations;
+			std::function<void(size_t)> setup;
+			std::function<size_t(size_t)> body;
+		};
+
+		std::vector<Case> m_cases{};
+	};
+
+	/// <summary>
+	/// תJSONַ
+	/// </summary>
+	static std::string escape(std::string_view value)
+	{
+		std::string escaped{};
+		for (auto c : value)
+		{
+			if (c == '"' || c == '\\') escaped += '\\';
+			escaped += c;
+		}
+		return escaped;
+	}
+
+	/// <summary>
+	/// Google BenchmarkJSONʽֱcompare.pyȽ
+	/// real_timecpu_timeΪظλ
+	/// </summary>
+	static void writeJson(std::FILE* file, const std::vector<Result>& results, const Options& options)
+	{
+		char date[32]{};
+		auto now{ std::time(nullptr) };
+		std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::gmtime(&now));
+
+#ifdef NDEBUG
+		constexpr const char* buildType{ "release" };
+#else
+		constexpr const char* buildType{ "debug" };
+#endif
+
+		std::fprintf(file, "{\n  \"context\": {\n");
+		std::fprintf(file, "    \"date\": \"%s\",\n", date);
+		std::fprintf(file, "    \"executable\": \"RTTRLibBenchmarks\",\n");
+		std::fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+		std::fprintf(file, "    \"library_build_type\": \"%s\",\n", buildType);
+		std::fprintf(file, "    \"repetitions\": %zu\n", options.repetitions);
+		std::fprintf(file, "  },\n  \"benchmarks\": [");
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const auto& result{ results[i] };
+			auto name{ escape(result.name) };
+			std::fprintf(file, "%s\n    {\n", i == 0 ? "" : ",");
+			std::fprintf(file, "      \"name\": \"%s\",\n", name.c_str());
+			std::fprintf(file, "      \"run_name\": \"%s\",\n", name.c_str());
+			std::fprintf(file, "      \"run_type\": \"iteration\",\n");
+			std::fprintf(file, "      \"repetitions\": %zu,\n", result.samples.size());
+			std::fprintf(file, "      \"iterations\": %zu,\n", result.iterations);
+			std::fprintf(file, "      \"real_time\": %.3f,\n", result.median());
+			std::fprintf(file, "      \"cpu_time\": %.3f,\n", result.median());
+			std::fprintf(file, "      \"min_time\": %.3f,\n", result.min());
+			std::fprintf(file, "      \"max_time\": %.3f,\n", result.max());
+			std::fprintf(file, "      \"time_unit\": \"ns\"\n    }");
+		}
+		std::fprintf(file, "\n  ]\n}\n");
+	}
+}
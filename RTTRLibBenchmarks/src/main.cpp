@@ -0,0 +1,543 @@
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "RTTR.h"
+#include "RTTRBenchmark.hpp"
+
+//׼ʹõͣԱ뷽intstd::stringķ俪
+struct BenchObject
+{
+	static inline int s_value{ 1 };
+	static int staticAdd(int a, int b) { return a + b; }
+	static int staticValue() { return s_value; }
+
+	int add(int value) { return m_value += value; }
+	int value() const { return m_value; }
+
+	int m_value{ 0 };
+};
+RTTR_REGISTER(BenchObject)
+
+RTTR_REGISTRATION(BenchObject)
+{
+	RTTR_REGISTER_CONSTRUCTOR(BenchObject, RTTR::Public);
+	RTTR_REGISTER_STATIC_MEMBER(BenchObject, RTTR::Public, s_value);
+	RTTR_REGISTER_NORMAL_MEMBER(BenchObject, RTTR::Public, m_value);
+	RTTR_REGISTER_STATIC_METHOD(BenchObject, RTTR::Public, staticAdd, int, int);
+	RTTR_REGISTER_STATIC_METHOD(BenchObject, RTTR::Public, staticValue);
+	RTTR_REGISTER_NORMAL_METHOD(BenchObject, RTTR::Public, int, add, int);
+	RTTR_REGISTER_CONST_METHOD(BenchObject, RTTR::Public, int, value);
+}
+
+//ֵ׼ʹõͣǰԱɵĸƺͱȽ϶
+struct BenchValue
+{
+	bool operator==(const BenchValue&) const = default;
+
+	int m_id{ 0 };
+	float m_x{ 0.0f };
+	float m_y{ 0.0f };
+	float m_z{ 0.0f };
+	double m_weight{ 1.0 };
+	std::string m_name{};
+	std::vector<int> m_values{};
+};
+RTTR_REGISTER(std::vector<int>)
+RTTR_REGISTER(BenchValue)
+
+RTTR_REGISTRATION(BenchValue)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(BenchValue, RTTR::Public, m_id);
+	RTTR_REGISTER_NORMAL_MEMBER(BenchValue, RTTR::Public, m_x);
+	RTTR_REGISTER_NORMAL_MEMBER(BenchValue, RTTR::Public, m_y);
+	RTTR_REGISTER_NORMAL_MEMBER(BenchValue, RTTR::Public, m_z);
+	RTTR_REGISTER_NORMAL_MEMBER(BenchValue, RTTR::Public, m_weight);
+	RTTR_REGISTER_NORMAL_MEMBER(BenchValue, RTTR::Public, m_name);
+	RTTR_REGISTER_NORMAL_MEMBER(BenchValue, RTTR::Public, m_values);
+}
+
+namespace
+{
+	constexpr size_t s_lookupIterations{ 1000000 };
+	constexpr size_t s_registerIterations{ 4096 };
+	constexpr size_t s_batchObjects{ 1000000 };
+	constexpr size_t s_nameCounts[]{ 100, 10000, 100000 };
+	constexpr size_t s_valueObjects{ 1024 };
+
+	//׼кϳע
+	constexpr size_t s_startupTypes{ 5000 };
+
+	//ÿעĿǼǵĿӽһͨ͵ĳԱ
+	constexpr size_t s_entriesPerTarget{ 8 };
+
+	/// <summary>
+	/// ע׼ĿͣʱǼǵȫֱ
+	/// </summary>
+	class SyntheticInfo final : public RTTR::RTTRInfo
+	{
+	public:
+		explicit SyntheticInfo(std::string_view name) : RTTRInfo(RTTR::typeId(name), name) {}
+
+	public:
+		size_t size() const override { return sizeof(BenchObject); }
+		size_t alignment() const override { return alignof(BenchObject); }
+		void destruct(void* o) const override { static_cast<BenchObject*>(o)->~BenchObject(); }
+
+	public:
+		bool registerSelf() { return registerRTTRInfo(this); }
+	};
+
+	/// <summary>
+	/// µעĿ꣬ڽЧ
+	/// </summary>
+	class Targets
+	{
+	public:
+		/// <summary>
+		/// ׼countµĿ꣬滻һ׼Ŀ
+		/// </summary>
+		void prepare(size_t count)
+		{
+			m_current.clear();
+			for (size_t i = 0; i < count; ++i)
+			{
+				auto& name{ s_names.emplace_back("BenchSynthetic" + std::to_string(s_names.size())) };
+				m_current.push_back(&s_infos.emplace_back(name));
+			}
+		}
+
+		SyntheticInfo* operator [](size_t index) const { return m_current[index]; }
+
+	private:
+		static inline std::deque<std::string> s_names{};
+		static inline std::deque<SyntheticInfo> s_infos{};
+		std::vector<SyntheticInfo*> m_current{};
+	};
+
+	constexpr std::string_view s_entryNames[s_entriesPerTarget]{ "m_a", "m_b", "m_c", "m_d", "m_e", "m_f", "m_g", "m_h" };
+
+	constexpr int (*s_staticAdd)(int, int){ &BenchObject::staticAdd };
+	constexpr int (BenchObject::*s_add)(int){ &BenchObject::add };
+	constexpr int (BenchObject::*s_value)() const { &BenchObject::value };
+
+	/// <summary>
+	/// ϳ͵ע飬Ǽs_entriesPerTargetͨԱӽһͨ
+	/// </summary>
+	void registerSynthetic(RTTR::RTTRInfo& info)
+	{
+		auto intInfo{ RTTR::RealRTTRInfo<int>::instance() };
+		for (size_t i = 0; i < s_entriesPerTarget; ++i) info.registerNormalMember({ s_entryNames[i], RTTR::Public, intInfo, static_cast<int>(i * sizeof(int)) });
+		info.registerStaticMethod({ "staticAdd", RTTR::Public, intInfo, s_staticAdd, &RTTR::invoker<s_staticAdd>, RTTR::unpackArgsInfo<int, int>() });
+		info.registerNormalMethod({ "add", RTTR::Public, intInfo, s_add, &RTTR::invoker<s_add>, RTTR::unpackArgsInfo<int>() });
+		info.registerConstMethod({ "value", RTTR::Public, intInfo, s_value, &RTTR::invoker<s_value>, RTTR::unpackArgsInfo<>() });
+	}
+
+	/// <summary>
+	/// ·첢עs_startupTypesϳͣÿεһ
+	/// eagerʱִע飬lazyֻǼע飻first queryΪlazy͵һβѯʱԱĿ
+	/// </summary>
+	void addStartup(RTTRBenchmark::Suite& suite)
+	{
+		static std::deque<std::string> s_names{};
+		static std::deque<SyntheticInfo> s_infos{};
+		static std::vector<std::string_view> s_current{};
+		static Targets s_lazy{};
+
+		auto names{ [](size_t iterations)
+			{
+				RTTR::thaw();
+				s_current.clear();
+				for (size_t i = 0; i < iterations; ++i) s_current.push_back(s_names.emplace_back("BenchStartup" + std::to_string(s_names.size())));
+			} };
+
+		suite.add("startup/eager", s_startupTypes, names, [](size_t i)
+			{
+				auto& info{ s_infos.emplace_back(s_current[i]) };
+				info.registerSelf();
+				registerSynthetic(info);
+				return size_t{ 1 };
+			});
+		suite.add("startup/lazy", s_startupTypes, names, [](size_t i)
+			{
+				auto& info{ s_infos.emplace_back(s_current[i]) };
+				info.registerSelf();
+				return static_cast<size_t>(info.registerLazy(&registerSynthetic));
+			});
+		suite.add("startup/lazy/first query", s_startupTypes, [](size_t iterations)
+			{
+				RTTR::thaw();
+				s_lazy.prepare(iterations);
+				for (size_t i = 0; i < iterations; ++i)
+				{
+					s_lazy[i]->registerSelf();
+					s_lazy[i]->registerLazy(&registerSynthetic);
+				}
+			}, [](size_t i)
+			{
+				return static_cast<size_t>(s_lazy[i]->normalMember("m_a") != nullptr);
+			});
+	}
+
+	/// <summary>
+	/// ֲҳԱs_nameCounts[i]Աֲңѯַ
+	/// unordered_mapΪգindexΪĿѰַsealedΪseal()ϣ
+	/// ÿڸһʱŽsealedseal()֮ǰͲǰ
+	/// </summary>
+	void addNameLookups(RTTRBenchmark::Suite& suite)
+	{
+		struct Names
+		{
+		public:
+			Targets target{};
+			std::vector<std::string> queries{};
+			std::unordered_map<std::string_view, const RTTR::NormalMemberInfo*> map{};
+		};
+		static std::map<size_t, Names> s_names{};
+
+		for (auto count : s_nameCounts)
+		{
+			auto prepare{ [count]() -> Names&
+				{
+					RTTR::thaw();
+					auto& names{ s_names[count] };
+					if (!names.queries.empty()) return names;
+
+					names.target.prepare(1);
+					auto info{ names.target[0] };
+					info->registerSelf();
+					auto intInfo{ RTTR::RealRTTRInfo<int>::instance() };
+					for (size_t i = 0; i < count; ++i)
+					{
+						names.queries.push_back("m_name" + std::to_string(i));
+						info->registerNormalMember({ names.queries.back(), RTTR::Public, intInfo, 0 });
+					}
+					for (const auto& member : info->normalMembers()) names.map.emplace(member.name, &member);
+
+					std::mt19937 random{ static_cast<std::mt19937::result_type>(count) };
+					std::shuffle(names.queries.begin(), names.queries.end(), random);
+					return names;
+				} };
+			auto prefix{ "names/" + std::to_string(count) + "/" };
+
+			suite.add(prefix + "unordered_map", s_lookupIterations, [prepare](size_t) { prepare(); }, [count](size_t i)
+				{
+					const auto& names{ s_names[count] };
+					auto find{ names.map.find(names.queries[i % names.queries.size()]) };
+					return static_cast<size_t>(find != names.map.end());
+				});
+			suite.add(prefix + "index", s_lookupIterations, [prepare](size_t) { prepare(); RTTR::freeze(); }, [count](size_t i)
+				{
+					const auto& names{ s_names[count] };
+					return static_cast<size_t>(names.target[0]->normalMember(names.queries[i % names.queries.size()]) != nullptr);
+				});
+			suite.add(prefix + "sealed", s_lookupIterations, [prepare](size_t) { prepare(); RTTR::seal(); }, [count](size_t i)
+				{
+					const auto& names{ s_names[count] };
+					return static_cast<size_t>(names.target[0]->normalMember(names.queries[i % names.queries.size()]) != nullptr);
+				});
+		}
+	}
+
+	/// <summary>
+	/// ֵ壺ơ¡Ƚϣs_valueObjectsеһcompiler/handwrittenΪֱдĶ
+	/// m_nameַȣĲֻڷķԱεĴ
+	/// </summary>
+	void addValues(RTTRBenchmark::Suite& suite)
+	{
+		static std::vector<BenchValue> s_values{};
+		static std::vector<BenchValue> s_copies{};
+		static BenchValue s_target{};
+
+		auto setup{ [](size_t)
+			{
+				RTTR::thaw();
+				if (!s_values.empty()) return;
+
+				for (size_t i = 0; i < s_valueObjects; ++i)
+				{
+					auto value{ static_cast<int>(i) };
+					s_values.push_back({ value, value * 0.5f, value * 1.5f, value * 2.5f, value * 0.25, "value" + std::to_string(i), { value, value + 1, value + 2, value + 3 } });
+				}
+				s_copies = s_values;
+			} };
+		auto info{ RTTR::RealRTTRInfo<BenchValue>::instance() };
+
+		suite.add("value/copy/compiler", s_lookupIterations, setup, [](size_t i)
+			{
+				s_target = s_values[i % s_valueObjects];
+				return static_cast<size_t>(s_target.m_id);
+			});
+		suite.add("value/copyMembers", s_lookupIterations, setup, [info](size_t i)
+			{
+				RTTR::copyMembers(*info, &s_target, &s_values[i % s_valueObjects]);
+				return static_cast<size_t>(s_target.m_id);
+			});
+		suite.add("value/clone/compiler new", s_lookupIterations, setup, [](size_t i)
+			{
+				auto clone{ new BenchValue{ s_values[i % s_valueObjects] } };
+				auto id{ static_cast<size_t>(clone->m_id) };
+				delete clone;
+				return id;
+			});
+		suite.add("value/clone", s_lookupIterations, setup, [info](size_t i)
+			{
+				auto clone{ RTTR::clone(s_values[i % s_valueObjects]) };
+				auto id{ static_cast<size_t>(clone->m_id) };
+				info->destroy(clone);
+				return id;
+			});
+		suite.add("value/equals/compiler", s_lookupIterations, setup, [](size_t i)
+			{
+				return static_cast<size_t>(s_values[i % s_valueObjects] == s_copies[i % s_valueObjects]);
+			});
+		suite.add("value/equals", s_lookupIterations, setup, [](size_t i)
+			{
+				return static_cast<size_t>(RTTR::equals(s_values[i % s_valueObjects], s_copies[i % s_valueObjects]));
+			});
+		suite.add("value/hash/handwritten", s_lookupIterations, setup, [](size_t i)
+			{
+				const auto& value{ s_values[i % s_valueObjects] };
+				auto seed{ std::hash<int>{}(value.m_id) };
+				seed = RTTR::hashCombine(seed, std::hash<float>{}(value.m_x));
+				seed = RTTR::hashCombine(seed, std::hash<float>{}(value.m_y));
+				seed = RTTR::hashCombine(seed, std::hash<float>{}(value.m_z));
+				seed = RTTR::hashCombine(seed, std::hash<double>{}(value.m_weight));
+				seed = RTTR::hashCombine(seed, std::hash<std::string>{}(value.m_name));
+				for (auto element : value.m_values) seed = RTTR::hashCombine(seed, std::hash<int>{}(element));
+				return seed;
+			});
+		suite.add("value/hash", s_lookupIterations, setup, [](size_t i)
+			{
+				return RTTR::hash(s_values[i % s_valueObjects]);
+			});
+	}
+
+	/// <summary>
+	/// ãs_batchObjectsͬһΪÿ
+	/// invokeNormalMethodÿ󶼰ֲңinlinepoolֻһΣpool߳1hardware_concurrency()չ
+	/// </summary>
+	void addBatch(RTTRBenchmark::Suite& suite)
+	{
+		using Add = int (BenchObject::*)(int);
+		static std::vector<BenchObject> s_objects{};
+		static std::vector<void*> s_pointers{};
+		static std::vector<int> s_results{};
+
+		auto setup{ [](size_t iterations)
+			{
+				RTTR::thaw();
+				s_objects.assign(iterations, BenchObject{});
+				s_pointers.clear();
+				for (auto& object : s_objects) s_pointers.push_back(&object);
+				s_results.assign(iterations, 0);
+			} };
+		auto sink{ [] { return static_cast<size_t>(s_results.front() + s_results.back()); } };
+
+		suite.addBulk("batch/invokeNormalMethod", s_batchObjects, setup, [sink](size_t iterations)
+			{
+				for (size_t i = 0; i < iterations; ++i) s_results[i] = RTTR::invokeNormalMethod<Add>(s_pointers[i], "BenchObject", "add", 1);
+				return sink();
+			});
+		suite.addBulk("batch/inline", s_batchObjects, setup, [sink](size_t)
+			{
+				const auto& add{ *RTTR::RTTRInfo::info("BenchObject")->normalMethod("add", RTTR::signature_traits<Add>::value) };
+				RTTR::invokeBatch<Add>(add, s_pointers, s_results.data(), nullptr, 1);
+				return sink();
+			});
+
+		std::vector<size_t> threads{};
+		auto hardware{ std::max(1u, std::thread::hardware_concurrency()) };
+		for (size_t count = 1; count < hardware; count *= 2) threads.push_back(count);
+		threads.push_back(hardware);
+
+		for (auto count : threads)
+		{
+			//̳߳еû׼ʱŴ˵Ļ׼߳
+			auto pool{ std::make_shared<std::unique_ptr<RTTR::ThreadPool>>() };
+			suite.addBulk("batch/pool/" + std::to_string(count) + " threads", s_batchObjects, [setup, pool, count](size_t iterations)
+				{
+					setup(iterations);
+					if (nullptr == *pool) *pool = std::make_unique<RTTR::ThreadPool>(count);
+				}, [sink, pool](size_t)
+				{
+					const auto& add{ *RTTR::RTTRInfo::info("BenchObject")->normalMethod("add", RTTR::signature_traits<Add>::value) };
+					RTTR::invokeBatch<Add>(add, s_pointers, s_results.data(), pool->get(), 1);
+					return sink();
+				});
+		}
+	}
+
+	/// <summary>
+	/// ѯ·frozenΪtrueʱڶע
+	/// </summary>
+	void addLookups(RTTRBenchmark::Suite& suite, bool frozen)
+	{
+		std::string suffix{ frozen ? "/frozen" : "" };
+		auto setup{ [frozen](size_t) { frozen ? RTTR::freeze() : RTTR::thaw(); } };
+		static BenchObject s_object{};
+
+		suite.add("RTTRInfo::info(name)" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return RTTR::RTTRInfo::info("BenchObject") != nullptr;
+			});
+		suite.add("RTTRInfo::info(name)/miss" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return RTTR::RTTRInfo::info("BenchMissing") != nullptr;
+			});
+		suite.add("RTTRInfo::info(TypeId)" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return RTTR::RTTRInfo::info(RTTR::RealRTTRInfo<BenchObject>::typeId) != nullptr;
+			});
+		suite.add("RTTR::valueStaticMember" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return static_cast<size_t>(RTTR::valueStaticMember<int>("BenchObject", "s_value"));
+			});
+		suite.add("RTTR::valueNormalMember" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return static_cast<size_t>(RTTR::valueNormalMember<int>(&s_object, "BenchObject", "m_value"));
+			});
+		suite.add("RTTR::invokeStaticMethod" + suffix, s_lookupIterations, setup, [](size_t i)
+			{
+				return static_cast<size_t>(RTTR::invokeStaticMethod<int(*)(int, int)>("BenchObject", "staticAdd", static_cast<int>(i), 1));
+			});
+		suite.add("RTTR::invokeNormalMethod" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return static_cast<size_t>(RTTR::invokeNormalMethod<int(BenchObject::*)(int)>(&s_object, "BenchObject", "add", 1));
+			});
+		//ѽķֻñںRTTR_INSTRUMENTATIONĿ
+		static const auto& s_addInfo{ *RTTR::RealRTTRInfo<BenchObject>::instance()->normalMethod("add", RTTR::signature_traits<int(BenchObject::*)(int)>::value) };
+		suite.add("MethodInfo::invoke" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return static_cast<size_t>(s_addInfo.invoke<int(BenchObject::*)(int)>(&s_object, 1));
+			});
+		suite.add("MethodInfo::call" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				int value{ 1 };
+				int result{ 0 };
+				void* args[]{ &value };
+				s_addInfo.call(&s_object, args, &result);
+				return static_cast<size_t>(result);
+			});
+		//̬ã뷵ֵVariantݣڴ
+		suite.add("MethodInfo::call(Variant)" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				static const RTTR::Variant s_args[]{ 1 };
+				return static_cast<size_t>(*s_addInfo.call(&s_object, s_args).get<int>());
+			});
+		suite.add("RTTR::invokeMethod(Variant)" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				static const RTTR::Variant s_args[]{ 1 };
+				return static_cast<size_t>(*RTTR::invokeMethod(&s_object, "BenchObject", "add", s_args).get<int>());
+			});
+		suite.add("RTTR::invokeConstMethod" + suffix, s_lookupIterations, setup, [](size_t)
+			{
+				return static_cast<size_t>(RTTR::invokeConstMethod<int(BenchObject::*)() const>(&s_object, "BenchObject", "value"));
+			});
+	}
+
+	/// <summary>
+	/// ע·ÿظµĿעᣬ⵽״עĿ
+	/// </summary>
+	void addRegistrations(RTTRBenchmark::Suite& suite)
+	{
+		static Targets s_targets{};
+		static Targets s_bases{};
+		auto perTarget{ [](size_t iterations) { RTTR::thaw(); s_targets.prepare((iterations + s_entriesPerTarget - 1) / s_entriesPerTarget); } };
+		auto perIteration{ [](size_t iterations) { RTTR::thaw(); s_targets.prepare(iterations); } };
+		auto intInfo{ RTTR::RealRTTRInfo<int>::instance() };
+
+		suite.add("RTTRInfo::registerRTTRInfo", s_registerIterations, perIteration, [](size_t i)
+			{
+				return s_targets[i]->registerSelf();
+			});
+		suite.add("RTTRInfo::registerRTTRInfo/duplicate", s_lookupIterations, [](size_t) { RTTR::thaw(); }, [](size_t)
+			{
+				static SyntheticInfo s_duplicate{ "BenchObject" };
+				return s_duplicate.registerSelf();
+			});
+		suite.add("RTTRInfo::registerSuperclass", s_registerIterations, [perTarget](size_t iterations)
+			{
+				perTarget(iterations);
+				s_bases.prepare(s_entriesPerTarget);
+			}, [](size_t i)
+			{
+				s_targets[i / s_entriesPerTarget]->registerSuperclass({ RTTR::Public, s_bases[i % s_entriesPerTarget], 0 });
+				return size_t{ 1 };
+			});
+		suite.add("RTTRInfo::registerConstructor", s_registerIterations, perIteration, [](size_t i)
+			{
+				return s_targets[i]->registerConstructor(RTTR::ConstructorInfo::of<>(RTTR::Public, std::type_identity<BenchObject>{}));
+			});
+		suite.add("RTTRInfo::registerStaticMember", s_registerIterations, perTarget, [intInfo](size_t i)
+			{
+				return s_targets[i / s_entriesPerTarget]->registerStaticMember({ s_entryNames[i % s_entriesPerTarget], RTTR::Public, intInfo, &BenchObject::s_value });
+			});
+		suite.add("RTTRInfo::registerNormalMember", s_registerIterations, perTarget, [intInfo](size_t i)
+			{
+				return s_targets[i / s_entriesPerTarget]->registerNormalMember({ s_entryNames[i % s_entriesPerTarget], RTTR::Public, intInfo, 0 });
+			});
+		suite.add("RTTRInfo::registerStaticMethod", s_registerIterations, perTarget, [intInfo](size_t i)
+			{
+				return s_targets[i / s_entriesPerTarget]->registerStaticMethod({ s_entryNames[i % s_entriesPerTarget], RTTR::Public, intInfo, s_staticAdd, &RTTR::invoker<s_staticAdd>, RTTR::unpackArgsInfo<int, int>() });
+			});
+		suite.add("RTTRInfo::registerNormalMethod", s_registerIterations, perTarget, [intInfo](size_t i)
+			{
+				return s_targets[i / s_entriesPerTarget]->registerNormalMethod({ s_entryNames[i % s_entriesPerTarget], RTTR::Public, intInfo, s_add, &RTTR::invoker<s_add>, RTTR::unpackArgsInfo<int>() });
+			});
+		suite.add("RTTRInfo::registerConstMethod", s_registerIterations, perTarget, [intInfo](size_t i)
+			{
+				return s_targets[i / s_entriesPerTarget]->registerConstMethod({ s_entryNames[i % s_entriesPerTarget], RTTR::Public, intInfo, s_value, &RTTR::invoker<s_value>, RTTR::unpackArgsInfo<>() });
+			});
+	}
+}
+
+int main(int argc, char** argv)
+{
+	RTTRBenchmark::Options options{};
+	if (!options.parse(argc, argv))
+	{
+		std::fprintf(stderr, "usage: RTTRLibBenchmarks [--filter=substring] [--format=console|json] [--out=file] [--repetitions=N] [--scale=factor] [--list]\n");
+		return 2;
+	}
+
+	RTTRBenchmark::Suite suite{};
+	addLookups(suite, false);
+	addRegistrations(suite);
+	addStartup(suite);
+	addBatch(suite);
+	addNameLookups(suite);
+	addValues(suite);
+	addLookups(suite, true);
+
+	if (options.list)
+	{
+		for (const auto& name : suite.names()) std::printf("%s\n", name.c_str());
+		return 0;
+	}
+
+	if (!options.json) std::printf("%-56s %15s %15s %10s\n", "benchmark", "median", "min", "iterations");
+	auto results{ suite.run(options) };
+	RTTR::thaw();
+
+	if (options.json)
+	{
+		auto file{ options.out.empty() ? stdout : std::fopen(options.out.c_str(), "w") };
+		if (file == nullptr)
+		{
+			std::fprintf(stderr, "cannot open %s\n", options.out.c_str());
+			return 1;
+		}
+		RTTRBenchmark::writeJson(file, results, options);
+		if (file != stdout) std::fclose(file);
+	}
+	return results.empty() ? 1 : 0;
+}
@@ -3,53 +3,30 @@
 #include "RTTR.h"
 #include "AFakeObject.h"
 
-RTTR_REGISTER(std::string)
-
-class AFakeObject
+RTTR_REGISTRATION(AFakeObject)
 {
-public:
-	static inline std::string s_string{ "AFakeObject::s_string" };
-
-public:
-	static std::string staticFunc();
-
-public:
-	AFakeObject();
-
-public:
-	std::string normalFunc();
-	std::string constFunc() const;
-
-public:
-	std::string m_string{ "AFakeObject::m_string" };
-};
-RTTR_REGISTER(AFakeObject);
+	RTTR_REGISTER_CONSTRUCTOR(AFakeObject, RTTR::Public);
+	RTTR_REGISTER_CONSTRUCTOR(AFakeObject, RTTR::Public, std::string);
+}
 
 void registerAFakeObject()
 {
-	RTTR::RealRTTRInfo<AFakeObject>::instance();
-	RTTR_REGISTER_STATIC_MEMBER(AFakeObject, RTTR::Public, s_string);
-	RTTR_REGISTER_STATIC_METHOD(AFakeObject, RTTR::Public, staticFunc);
+	RTTR::Registration<AFakeObject>::once();
 }
 
 AFakeObject* createAFakeObject()
 {
-	auto object{ new AFakeObject{} };
-	return object;
+	return static_cast<AFakeObject*>(RTTR::create("AFakeObject"));
 }
 
-std::string AFakeObject::staticFunc()
+AFakeObject::AFakeObject(std::string string) :
+	m_string(std::move(string))
 {
-	return "AFakeObject::staticFunc()";
 }
 
-AFakeObject::AFakeObject()
+std::string AFakeObject::staticFunc()
 {
-	RTTR_REGISTER_NORMAL_MEMBER(RTTR::Public, m_string);
-
-	RTTR_REGISTER_NORMAL_METHOD(RTTR::Public, std::string, normalFunc);
-
-	RTTR_REGISTER_CONST_METHOD(RTTR::Public, std::string, constFunc);
+	return "AFakeObject::staticFunc()";
 }
 
 std::string AFakeObject::normalFunc()
@@ -57,6 +34,11 @@ std::string AFakeObject::normalFunc()
 	return "AFakeObject::normalFunc()";
 }
 
+std::string AFakeObject::normalFunc(std::string suffix)
+{
+	return "AFakeObject::normalFunc(" + suffix + ")";
+}
+
 std::string AFakeObject::constFunc() const
 {
 	return "AFakeObject::constFunc() const";
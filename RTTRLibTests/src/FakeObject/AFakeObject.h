@@ -1,5 +1,48 @@
 #pragma once
 
-class AFakeObject;
+#include <string>
+
+#include "RTTR.h"
+
+class AFakeObject
+{
+public:
+	static inline std::string s_string{ "AFakeObject::s_string" };
+
+public:
+	static std::string staticFunc();
+
+public:
+	AFakeObject() = default;
+	explicit AFakeObject(std::string string);
+
+public:
+	std::string normalFunc();
+	std::string normalFunc(std::string suffix);
+	std::string constFunc() const;
+
+public:
+	std::string m_string{ "AFakeObject::m_string" };
+};
+RTTR_REGISTER(AFakeObject);
+
+template<>
+struct RTTR::static_info<AFakeObject>
+{
+	static constexpr std::tuple members
+	{
+		RTTR_MEMBER(AFakeObject, RTTR::Public, s_string),
+		RTTR_MEMBER(AFakeObject, RTTR::Public, m_string),
+	};
+
+	static constexpr std::tuple methods
+	{
+		RTTR_METHOD(AFakeObject, RTTR::Public, staticFunc),
+		RTTR_OVERLOAD(AFakeObject, RTTR::Public, normalFunc, std::string (AFakeObject::*)()),
+		RTTR_OVERLOAD(AFakeObject, RTTR::Public, normalFunc, std::string (AFakeObject::*)(std::string)),
+		RTTR_METHOD(AFakeObject, RTTR::Public, constFunc),
+	};
+};
+
 void registerAFakeObject();
 AFakeObject* createAFakeObject();
@@ -0,0 +1,12 @@
+#include "RTTR.h"
+#include "BFakeObject.h"
+
+//Ա뷽static_info<BFakeObject>
+RTTR_REGISTRATION(BFakeObject)
+{
+}
+
+void registerBFakeObject()
+{
+	RTTR::Registration<BFakeObject>::once();
+}
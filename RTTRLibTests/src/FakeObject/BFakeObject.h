@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include "RTTR.h"
+
+class BFakeObject
+{
+public:
+	float m_x{ 0.0f };
+	float m_y{ 0.0f };
+	float m_z{ 0.0f };
+	int m_id{ 0 };
+	double m_weight{ 1.0 };
+	std::string m_name{ "BFakeObject::m_name" };
+};
+RTTR_REGISTER(BFakeObject);
+
+template<>
+struct RTTR::static_info<BFakeObject>
+{
+	static constexpr std::tuple members
+	{
+		RTTR_MEMBER(BFakeObject, RTTR::Public, m_x),
+		RTTR_MEMBER(BFakeObject, RTTR::Public, m_y),
+		RTTR_MEMBER(BFakeObject, RTTR::Public, m_z),
+		RTTR_MEMBER(BFakeObject, RTTR::Public, m_id),
+		RTTR_MEMBER(BFakeObject, RTTR::Public, m_weight),
+		RTTR_MEMBER(BFakeObject, RTTR::Public, m_name),
+	};
+};
+
+void registerBFakeObject();
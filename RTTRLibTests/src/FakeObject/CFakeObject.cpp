@@ -0,0 +1,16 @@
+#include "RTTR.h"
+#include "CFakeObject.h"
+
+RTTR_REGISTRATION(CFakeObject)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(CFakeObject, RTTR::Public, m_version);
+	RTTR_REGISTER_NORMAL_MEMBER(CFakeObject, RTTR::Public, m_child);
+	RTTR_REGISTER_NORMAL_MEMBER(CFakeObject, RTTR::Public, m_ids);
+	RTTR_REGISTER_NORMAL_MEMBER(CFakeObject, RTTR::Public, m_table);
+	RTTR_REGISTER_NORMAL_MEMBER(CFakeObject, RTTR::Public, m_children);
+}
+
+void registerCFakeObject()
+{
+	RTTR::Registration<CFakeObject>::once();
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "RTTR.h"
+#include "BFakeObject.h"
+
+using CFakeTable = std::map<std::string, int>;
+
+RTTR_REGISTER(std::vector<int>)
+RTTR_REGISTER(std::vector<BFakeObject>)
+RTTR_REGISTER(CFakeTable)
+
+class CFakeObject
+{
+public:
+	int m_version{ 1 };
+	BFakeObject m_child{};
+	std::vector<int> m_ids{};
+	CFakeTable m_table{};
+	std::vector<BFakeObject> m_children{};
+};
+RTTR_REGISTER(CFakeObject);
+
+void registerCFakeObject();
@@ -0,0 +1,126 @@
+#pragma once
+
+//MSVC CppUnitTestܵĿֲṩõĲ֣CMakeڷVisual Studioв
+//ÿTEST_METHODھ̬ʼʱǼǵRegistryPortable/main.cppִ
+
+#include <cstdio>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	/// <summary>
+	/// ʧʱ׳쳣
+	/// </summary>
+	class AssertFailed : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+	/// <summary>
+	/// ˳ǼǵģʼԷ
+	/// </summary>
+	struct Registry
+	{
+		struct Test
+		{
+			std::string name;
+			std::function<void()> run;
+		};
+
+		static std::vector<void(*)()>& initializers()
+		{
+			static std::vector<void(*)()> s_initializers{};
+			return s_initializers;
+		}
+
+		static std::vector<Test>& tests()
+		{
+			static std::vector<Test> s_tests{};
+			return s_tests;
+		}
+
+		static bool addInitializer(void (*initializer)())
+		{
+			initializers().push_back(initializer);
+			return true;
+		}
+
+		static bool addTest(const char* name, std::function<void()> run)
+		{
+			tests().push_back({ name, std::move(run) });
+			return true;
+		}
+	};
+
+	template<typename T>
+	struct TestClass
+	{
+		using Self = T;
+	};
+
+	struct Logger
+	{
+		static void WriteMessage(const char* message) { std::printf("%s\n", message); }
+		static void WriteMessage(const std::string& message) { WriteMessage(message.c_str()); }
+	};
+
+	struct Assert
+	{
+		template<typename E, typename A>
+		static void AreEqual(const E& expected, const A& actual, const char* message = "AreEqual")
+		{
+			if (!(expected == actual)) Fail(message);
+		}
+
+		template<typename P>
+		static void IsNull(const P* pointer, const char* message = "IsNull")
+		{
+			if (pointer != nullptr) Fail(message);
+		}
+
+		template<typename P>
+		static void IsNotNull(const P* pointer, const char* message = "IsNotNull")
+		{
+			if (pointer == nullptr) Fail(message);
+		}
+
+		static void IsTrue(bool condition, const char* message = "IsTrue")
+		{
+			if (!condition) Fail(message);
+		}
+
+		static void IsFalse(bool condition, const char* message = "IsFalse")
+		{
+			if (condition) Fail(message);
+		}
+
+		template<typename E, typename F>
+		static void ExpectException(F functor, const char* message = "ExpectException")
+		{
+			try { functor(); }
+			catch (const E&) { return; }
+			Fail(message);
+		}
+
+		[[noreturn]] static void Fail(const char* message) { throw AssertFailed{ message }; }
+	};
+}
+
+#define TEST_MODULE_INITIALIZE(Name) \
+	static void Name(); \
+	[[maybe_unused]] static const bool Name##_registered{ Microsoft::VisualStudio::CppUnitTestFramework::Registry::addInitializer(&Name) }; \
+	static void Name()
+
+#define TEST_CLASS(Name) struct Name : Microsoft::VisualStudio::CppUnitTestFramework::TestClass<Name>
+
+#define TEST_METHOD(Name) \
+	struct Name##_registrar \
+	{ \
+		Name##_registrar() { Microsoft::VisualStudio::CppUnitTestFramework::Registry::addTest(#Name, [] { Self{}.Name(); }); } \
+	}; \
+	static inline const Name##_registrar Name##_registered{}; \
+	void Name()
@@ -0,0 +1,56 @@
+//ֲCppUnitTestĲ
+//޲ʱȫԣʱֻЩԣ--listȫ
+//ʧܵĲ
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string_view>
+
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && std::strcmp(argv[1], "--list") == 0)
+	{
+		for (const auto& test : Registry::tests()) std::printf("%s\n", test.name.c_str());
+		return 0;
+	}
+
+	auto selected{ [argc, argv](std::string_view name)
+		{
+			if (argc < 2) return true;
+			for (int i = 1; i < argc; ++i) if (name == argv[i]) return true;
+			return false;
+		} };
+
+	for (auto initializer : Registry::initializers()) initializer();
+
+	int run{ 0 };
+	int failed{ 0 };
+	for (const auto& test : Registry::tests())
+	{
+		if (!selected(test.name)) continue;
+		++run;
+		try
+		{
+			test.run();
+			std::printf("[  PASSED  ] %s\n", test.name.c_str());
+		}
+		catch (const std::exception& e)
+		{
+			++failed;
+			std::printf("[  FAILED  ] %s: %s\n", test.name.c_str(), e.what());
+		}
+	}
+
+	if (run == 0)
+	{
+		std::printf("no test matched\n");
+		return 1;
+	}
+	std::printf("%d test(s), %d failed\n", run, failed);
+	return failed;
+}
@@ -0,0 +1,808 @@
+#include <algorithm>
+#include <any>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "RTTR.h"
+#include "CppUnitTest.h"
+
+#include "FakeObject/AFakeObject.h"
+#include "FakeObject/BFakeObject.h"
+
+//ջ׼ʹõĿƽƼ¼BFakeObjectֵԱͬ
+struct SnapshotRecord
+{
+	float m_x{ 0.0f };
+	float m_y{ 0.0f };
+	float m_z{ 0.0f };
+	int m_id{ 0 };
+	double m_weight{ 0.0 };
+};
+RTTR_REGISTER(SnapshotRecord)
+
+//׼ʹõСPooledRecordöأHeapRecordͨö
+struct PooledRecord
+{
+	int m_id{ 0 };
+	float m_x{ 0.0f };
+	double m_weight{ 0.0 };
+	void* m_owner{ nullptr };
+};
+RTTR_REGISTER(PooledRecord)
+
+struct HeapRecord
+{
+	int m_id{ 0 };
+	float m_x{ 0.0f };
+	double m_weight{ 0.0 };
+	void* m_owner{ nullptr };
+};
+RTTR_REGISTER(HeapRecord)
+
+RTTR_REGISTRATION(PooledRecord)
+{
+	RTTR_REGISTER_CONSTRUCTOR(PooledRecord, RTTR::Public);
+	RTTR_REGISTER_POOL(PooledRecord, 256);
+}
+
+RTTR_REGISTRATION(HeapRecord)
+{
+	RTTR_REGISTER_CONSTRUCTOR(HeapRecord, RTTR::Public);
+}
+
+RTTR_REGISTRATION(SnapshotRecord)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotRecord, RTTR::Public, m_x);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotRecord, RTTR::Public, m_y);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotRecord, RTTR::Public, m_z);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotRecord, RTTR::Public, m_id);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotRecord, RTTR::Public, m_weight);
+}
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace RTTRLibTests
+{
+	/// <summary>
+	/// ʱÿεõƽʱ
+	/// </summary>
+	/// <param name="name"></param>
+	/// <param name="iterations"></param>
+	/// <param name="func">⺯ֵۼԷŻ</param>
+	template<typename Func>
+	static void benchmark(const std::string& name, size_t iterations, Func func)
+	{
+		size_t sink{ 0 };
+		auto begin{ std::chrono::steady_clock::now() };
+		for (size_t i = 0; i < iterations; ++i) sink += func();
+		auto end{ std::chrono::steady_clock::now() };
+
+		auto ns{ std::chrono::duration<double, std::nano>(end - begin).count() / iterations };
+		Logger::WriteMessage((name + ": " + std::to_string(ns) + " ns/call (" + std::to_string(sink) + ")").c_str());
+	}
+
+	static constexpr size_t s_iterations{ 1000000 };
+
+	/// <summary>
+	/// glibc mallocĹһηʵռõֽ8ֽڿͷ16ֽڶ룬С32ֽ
+	/// </summary>
+	/// <param name="bytes"></param>
+	/// <returns></returns>
+	static size_t mallocSize(size_t bytes) { return std::max<size_t>(32, (bytes + 8 + 15) / 16 * 16); }
+
+	/// <summary>
+	/// ͳƷֽķڹɲֵڴռ
+	/// </summary>
+	template<typename T>
+	struct CountingAllocator
+	{
+	public:
+		using value_type = T;
+
+	public:
+		CountingAllocator() = default;
+		explicit CountingAllocator(size_t* bytes) : bytes(bytes) {}
+
+		template<typename U>
+		CountingAllocator(const CountingAllocator<U>& other) : bytes(other.bytes) {}
+
+	public:
+		T* allocate(size_t n) { if (bytes) *bytes += mallocSize(n * sizeof(T)); return std::allocator<T>{}.allocate(n); }
+		void deallocate(T* p, size_t n) { if (bytes) *bytes -= mallocSize(n * sizeof(T)); std::allocator<T>{}.deallocate(p, n); }
+
+		template<typename U>
+		bool operator ==(const CountingAllocator<U>& other) const { return bytes == other.bytes; }
+
+	public:
+		size_t* bytes{ nullptr };
+	};
+
+	/// <summary>
+	/// ɵע֣ÿһϵʵֶ󣬳Ա뷽std::stringΪĽڵУ
+	/// Ŀɵöstd::anyУϢstd::list
+	/// </summary>
+	namespace Legacy
+	{
+		using String = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+		struct Hash
+		{
+			size_t operator ()(const String& value) const { return std::hash<std::string_view>{}(value); }
+		};
+
+		struct Member
+		{
+			String name;
+			RTTR::Interview interview;
+			RTTR::RTTRInfo* info;
+			int offset;
+		};
+
+		struct Method
+		{
+			String name;
+			RTTR::Interview interview;
+			RTTR::RTTRInfo* returnInfo;
+			std::any callable;
+			std::list<RTTR::RTTRInfo*, CountingAllocator<RTTR::RTTRInfo*>> args;
+			void* address;
+		};
+
+		template<typename V>
+		using Map = std::unordered_map<String, V, Hash, std::equal_to<>, CountingAllocator<std::pair<const String, V>>>;
+
+		template<typename V>
+		using MultiMap = std::unordered_multimap<String, V, Hash, std::equal_to<>, CountingAllocator<std::pair<const String, V>>>;
+
+		struct Impl
+		{
+			explicit Impl(size_t* bytes) :
+				superclass(CountingAllocator<RTTR::Superclass>{ bytes }),
+				staticMembers(CountingAllocator<std::pair<const String, Member>>{ bytes }), normalMembers(CountingAllocator<std::pair<const String, Member>>{ bytes }),
+				staticMethods(CountingAllocator<std::pair<const String, Method>>{ bytes }), normalMethods(CountingAllocator<std::pair<const String, Method>>{ bytes }), constMethods(CountingAllocator<std::pair<const String, Method>>{ bytes })
+			{
+			}
+
+			std::list<RTTR::Superclass, CountingAllocator<RTTR::Superclass>> superclass;
+			Map<Member> staticMembers;
+			Map<Member> normalMembers;
+			MultiMap<Method> staticMethods;
+			MultiMap<Method> normalMethods;
+			MultiMap<Method> constMethods;
+		};
+	}
+
+	/// <summary>
+	/// ʱĺϳͣע
+	/// </summary>
+	class SyntheticInfo final : public RTTR::RTTRInfo
+	{
+	public:
+		explicit SyntheticInfo(std::string_view name) : RTTRInfo(RTTR::typeId(name), name) { registerRTTRInfo(this); }
+
+	public:
+		size_t size() const override { return sizeof(AFakeObject); }
+		size_t alignment() const override { return alignof(AFakeObject); }
+		void destruct(void* o) const override { static_cast<AFakeObject*>(o)->~AFakeObject(); }
+	};
+
+	TEST_CLASS(RTTRBenchmarks)
+	{
+	public:
+		TEST_METHOD(Benchmark_invokeStaticMethod_vs_MethodHandle)
+		{
+			benchmark("invokeStaticMethod", s_iterations, []
+				{
+					return RTTR::invokeStaticMethod<std::string(*)()>("AFakeObject", "staticFunc").size();
+				});
+
+			auto handle{ RTTR::staticMethodHandle<std::string(*)()>("AFakeObject", "staticFunc") };
+			benchmark("MethodHandle::invoke (static)", s_iterations, [&handle] { return handle.invoke().size(); });
+		}
+
+		TEST_METHOD(Benchmark_invokeNormalMethod_vs_MethodHandle)
+		{
+			auto object{ createAFakeObject() };
+			benchmark("invokeNormalMethod", s_iterations, [object]
+				{
+					return RTTR::invokeNormalMethod<std::string(AFakeObject::*)()>(object, "AFakeObject", "normalFunc").size();
+				});
+
+			auto handle{ RTTR::normalMethodHandle<std::string(AFakeObject::*)()>("AFakeObject", "normalFunc") };
+			benchmark("MethodHandle::invoke (normal)", s_iterations, [&handle, object] { return handle.invoke(object).size(); });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(Benchmark_invokeConstMethod_vs_MethodHandle)
+		{
+			auto object{ createAFakeObject() };
+			benchmark("invokeConstMethod", s_iterations, [object]
+				{
+					return RTTR::invokeConstMethod<std::string(AFakeObject::*)() const>(object, "AFakeObject", "constFunc").size();
+				});
+
+			auto handle{ RTTR::constMethodHandle<std::string(AFakeObject::*)() const>("AFakeObject", "constFunc") };
+			benchmark("MethodHandle::invoke (const)", s_iterations, [&handle, object] { return handle.invoke(object).size(); });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(Benchmark_valueNormalMember_vs_MemberHandle)
+		{
+			auto object{ createAFakeObject() };
+			benchmark("valueNormalMember", s_iterations, [object]
+				{
+					return RTTR::valueNormalMember<std::string>(object, "AFakeObject", "m_string").size();
+				});
+
+			auto handle{ RTTR::normalMemberHandle<std::string>("AFakeObject", "m_string") };
+			benchmark("NormalMemberHandle::value", s_iterations, [&handle, object] { return handle.value(object).size(); });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(Benchmark_valueNormalMember_vs_crefNormalMember)
+		{
+			auto object{ createAFakeObject() };
+			auto member{ RTTR::RTTRInfo::info("AFakeObject")->normalMember("m_string") };
+			benchmark("NormalMemberInfo::value (copy)", s_iterations, [member, object] { return member->value<std::string>(object).size(); });
+			benchmark("NormalMemberInfo::cref", s_iterations, [member, object] { return member->cref<std::string>(object).size(); });
+			benchmark("NormalMemberInfo::set (move)", s_iterations, [member, object]
+				{
+					member->set<std::string>(object, std::string(32, 'x'));
+					return member->cref<std::string>(object).size();
+				});
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(Benchmark_MethodInfo_any_vs_invoke_vs_call)
+		{
+			using F = std::string(AFakeObject::*)() const;
+
+			auto object{ createAFakeObject() };
+			auto methodInfo{ RTTR::RTTRInfo::info("AFakeObject")->constMethod("constFunc", RTTR::signature_traits<F>::value) };
+
+			std::any any{ static_cast<F>(&AFakeObject::constFunc) };
+			benchmark("std::any_cast + std::invoke", s_iterations, [&any, object] { return std::invoke(std::any_cast<F>(any), object).size(); });
+
+			benchmark("MethodInfo::invoke<F>", s_iterations, [methodInfo, object] { return methodInfo->invoke<F>(object).size(); });
+
+			benchmark("MethodInfo::call", s_iterations, [methodInfo, object]
+				{
+					alignas(std::string) unsigned char ret[sizeof(std::string)];
+					methodInfo->call(object, nullptr, ret);
+
+					auto string{ std::launder(reinterpret_cast<std::string*>(ret)) };
+					auto size{ string->size() };
+					std::destroy_at(string);
+					return size;
+				});
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(Benchmark_RTTRInfo_info_threadScaling)
+		{
+			auto lookup{ [](const std::string& mode)
+				{
+					auto maxThreads{ std::max(1u, std::thread::hardware_concurrency()) };
+					for (unsigned threadCount = 1; ; threadCount = std::min(threadCount * 2, maxThreads))
+					{
+						std::vector<std::thread> threads{};
+						auto begin{ std::chrono::steady_clock::now() };
+						for (unsigned t = 0; t < threadCount; ++t)
+						{
+							threads.emplace_back([]
+								{
+									size_t sink{ 0 };
+									for (size_t i = 0; i < s_iterations; ++i)
+										sink += reinterpret_cast<size_t>(RTTR::RTTRInfo::info("AFakeObject")->normalMember("m_string"));
+									return sink;
+								});
+						}
+						for (auto& thread : threads) thread.join();
+						auto end{ std::chrono::steady_clock::now() };
+
+						auto ns{ std::chrono::duration<double, std::nano>(end - begin).count() / s_iterations };
+						Logger::WriteMessage((mode + " info+normalMember, " + std::to_string(threadCount) + " threads: " + std::to_string(ns) + " ns/call per thread").c_str());
+						if (threadCount == maxThreads) break;
+					}
+				} };
+
+			RTTR::thaw();
+			lookup("locked");
+			RTTR::freeze();
+			lookup("frozen");
+			RTTR::thaw();
+		}
+
+		TEST_METHOD(Benchmark_registry_memoryFootprint)
+		{
+			constexpr size_t typeCount{ 3000 };
+			static constexpr std::string_view s_memberNames[]
+			{
+				"m_position", "m_rotation", "m_scale", "m_velocity", "m_name", "m_owner", "m_lastUpdateTimestamp", "m_renderLayerMask",
+			};
+			static constexpr std::string_view s_staticNames[]{ "s_instanceCount", "s_defaultConfiguration" };
+
+			static constexpr std::string (AFakeObject::*s_normalFunc)() { &AFakeObject::normalFunc };
+			static constexpr std::string (AFakeObject::*s_normalFuncSuffix)(std::string) { &AFakeObject::normalFunc };
+			static constexpr std::string (AFakeObject::*s_constFunc)() const { &AFakeObject::constFunc };
+
+			auto stringInfo{ RTTR::RTTRInfo::info("std::string") };
+
+			//²֣ڴصΪȫռ
+			static std::deque<std::string> s_typeNames{};
+			static std::deque<SyntheticInfo> s_types{};
+			auto arenaBefore{ RTTR::Arena::instance().reserved() };
+			for (size_t i = 0; i < typeCount; ++i)
+			{
+				auto& type{ s_types.emplace_back(s_typeNames.emplace_back("SyntheticType" + std::to_string(i))) };
+				for (auto name : s_memberNames) type.registerNormalMember({ name, RTTR::Public, stringInfo, 0 });
+				for (auto name : s_staticNames) type.registerStaticMember({ name, RTTR::Public, stringInfo, &AFakeObject::s_string });
+				type.registerNormalMethod({ "update", RTTR::Public, stringInfo, s_normalFunc, &RTTR::invoker<s_normalFunc>, RTTR::unpackArgsInfo<>() });
+				type.registerNormalMethod({ "update", RTTR::Public, stringInfo, s_normalFuncSuffix, &RTTR::invoker<s_normalFuncSuffix>, RTTR::unpackArgsInfo<std::string>() });
+				type.registerNormalMethod({ "serialize", RTTR::Public, stringInfo, s_normalFunc, &RTTR::invoker<s_normalFunc>, RTTR::unpackArgsInfo<>() });
+				type.registerConstMethod({ "describe", RTTR::Public, stringInfo, s_constFunc, &RTTR::invoker<s_constFunc>, RTTR::unpackArgsInfo<>() });
+			}
+			auto arenaBytes{ RTTR::Arena::instance().reserved() - arenaBefore };
+
+			//ɲ֣ͬԱɵṹ
+			size_t legacyBytes{ 0 };
+			{
+				std::unordered_map<Legacy::String, RTTR::RTTRInfo*, Legacy::Hash, std::equal_to<>, CountingAllocator<std::pair<const Legacy::String, RTTR::RTTRInfo*>>> infos{ CountingAllocator<int>{ &legacyBytes } };
+				std::vector<std::unique_ptr<Legacy::Impl>> impls{};
+				auto string{ [&legacyBytes](std::string_view value) { return Legacy::String{ value, CountingAllocator<char>{ &legacyBytes } }; } };
+				auto method{ [&](std::string_view name, auto callable, std::initializer_list<RTTR::RTTRInfo*> args)
+					{
+						//Ųstd::anyڲĳԱָᵥ
+						if constexpr (sizeof(callable) > sizeof(void*)) legacyBytes += mallocSize(sizeof(callable));
+						return Legacy::Method{ string(name), RTTR::Public, stringInfo, callable, { args, CountingAllocator<RTTR::RTTRInfo*>{ &legacyBytes } }, nullptr };
+					} };
+
+				for (size_t i = 0; i < typeCount; ++i)
+				{
+					infos.insert({ string(s_typeNames[i]), &s_types[i] });
+					auto& impl{ *impls.emplace_back(new Legacy::Impl{ &legacyBytes }) };
+					legacyBytes += mallocSize(sizeof(Legacy::Impl));
+
+					for (auto name : s_memberNames) impl.normalMembers.insert({ string(name), { string(name), RTTR::Public, stringInfo, 0 } });
+					for (auto name : s_staticNames) impl.staticMembers.insert({ string(name), { string(name), RTTR::Public, stringInfo, 0 } });
+					impl.normalMethods.insert({ string("update"), method("update", s_normalFunc, {}) });
+					impl.normalMethods.insert({ string("update"), method("update", s_normalFuncSuffix, { stringInfo }) });
+					impl.normalMethods.insert({ string("serialize"), method("serialize", s_normalFunc, {}) });
+					impl.constMethods.insert({ string("describe"), method("describe", s_constFunc, {}) });
+				}
+
+				Logger::WriteMessage(("legacy layout, " + std::to_string(typeCount) + " types: " + std::to_string(legacyBytes) + " bytes (" + std::to_string(legacyBytes / typeCount) + " bytes/type)").c_str());
+			}
+			Logger::WriteMessage(("arena layout, " + std::to_string(typeCount) + " types: " + std::to_string(arenaBytes) + " bytes reserved (" + std::to_string(arenaBytes / typeCount) + " bytes/type)").c_str());
+
+			size_t members{ 0 };
+			for (const auto& type : s_types)
+				for (const auto& member : type.normalMembers()) members += member.name.size() != 0;
+			Assert::AreEqual(members, typeCount * std::size(s_memberNames));
+			Assert::IsTrue(s_types.back().normalMember("m_lastUpdateTimestamp")->name.data() == s_types.front().normalMember("m_lastUpdateTimestamp")->name.data());
+		}
+
+		TEST_METHOD(Benchmark_gatherNormalMember_vs_perObject_vs_handwritten)
+		{
+			constexpr size_t objectCount{ 100000 };
+			constexpr size_t passes{ 100 };
+
+			std::vector<BFakeObject> objects(objectCount);
+			for (size_t i = 0; i < objectCount; ++i) objects[i].m_x = static_cast<float>(i);
+			std::vector<float> xs(objectCount);
+
+			benchmark("valueNormalMember per object (100000 objects)", passes, [&objects, &xs]
+				{
+					for (size_t i = 0; i < objects.size(); ++i) xs[i] = RTTR::valueNormalMember<float>(&objects[i], "BFakeObject", "m_x");
+					return static_cast<size_t>(xs.back());
+				});
+
+			auto member{ RTTR::RTTRInfo::info("BFakeObject")->normalMember("m_x") };
+			benchmark("NormalMemberInfo::value per object (100000 objects)", passes, [&objects, &xs, member]
+				{
+					for (size_t i = 0; i < objects.size(); ++i) xs[i] = member->value<float>(&objects[i]);
+					return static_cast<size_t>(xs.back());
+				});
+
+			benchmark("gatherNormalMember (100000 objects)", passes, [&objects, &xs]
+				{
+					RTTR::gatherNormalMember(objects.data(), objects.size(), "BFakeObject", "m_x", xs.data());
+					return static_cast<size_t>(xs.back());
+				});
+
+			benchmark("handwritten gather (100000 objects)", passes, [&objects, &xs]
+				{
+					for (size_t i = 0; i < objects.size(); ++i) xs[i] = objects[i].m_x;
+					return static_cast<size_t>(xs.back());
+				});
+
+			benchmark("scatterNormalMember (100000 objects)", passes, [&objects, &xs]
+				{
+					RTTR::scatterNormalMember(objects.data(), objects.size(), "BFakeObject", "m_x", xs.data());
+					return static_cast<size_t>(objects.back().m_x);
+				});
+
+			benchmark("handwritten scatter (100000 objects)", passes, [&objects, &xs]
+				{
+					for (size_t i = 0; i < objects.size(); ++i) objects[i].m_x = xs[i];
+					return static_cast<size_t>(objects.back().m_x);
+				});
+		}
+
+		TEST_METHOD(Benchmark_serialize_vs_handwritten)
+		{
+			constexpr size_t objectCount{ 100000 };
+			constexpr size_t passes{ 20 };
+
+			std::vector<BFakeObject> objects(objectCount);
+			for (size_t i = 0; i < objectCount; ++i)
+			{
+				objects[i].m_id = static_cast<int>(i);
+				objects[i].m_name = "object" + std::to_string(i);
+			}
+
+			RTTR::BinaryWriter writer{};
+			auto throughput{ [&writer](const std::string& name, auto func)
+				{
+					auto begin{ std::chrono::steady_clock::now() };
+					size_t bytes{ 0 };
+					for (size_t pass = 0; pass < passes; ++pass) bytes += func();
+					auto end{ std::chrono::steady_clock::now() };
+
+					auto seconds{ std::chrono::duration<double>(end - begin).count() };
+					Logger::WriteMessage((name + ": " + std::to_string(bytes / seconds / (1024 * 1024)) + " MB/s").c_str());
+				} };
+
+			throughput("RTTR::serialize", [&]
+				{
+					writer.clear();
+					RTTR::serialize(objects, writer);
+					return writer.size();
+				});
+
+			throughput("handwritten serialize", [&]
+				{
+					writer.clear();
+					writer.write(static_cast<uint64_t>(objects.size()));
+					for (const auto& object : objects)
+					{
+						writer.write(object.m_x);
+						writer.write(object.m_y);
+						writer.write(object.m_z);
+						writer.write(object.m_id);
+						writer.write(object.m_weight);
+						writer.write(static_cast<uint64_t>(object.m_name.size()));
+						writer.write(object.m_name.data(), object.m_name.size());
+					}
+					return writer.size();
+				});
+
+			std::vector<BFakeObject> copies{};
+			throughput("RTTR::deserialize", [&]
+				{
+					RTTR::BinaryReader reader{ writer.data(), writer.size() };
+					RTTR::deserialize(copies, reader);
+					return writer.size();
+				});
+
+			throughput("handwritten deserialize", [&]
+				{
+					RTTR::BinaryReader reader{ writer.data(), writer.size() };
+					uint64_t count{ 0 };
+					reader.read(count);
+					copies.resize(count);
+					for (auto& object : copies)
+					{
+						uint64_t size{ 0 };
+						reader.read(object.m_x);
+						reader.read(object.m_y);
+						reader.read(object.m_z);
+						reader.read(object.m_id);
+						reader.read(object.m_weight);
+						reader.read(size);
+						object.m_name.resize(size);
+						reader.read(object.m_name.data(), size);
+					}
+					return writer.size();
+				});
+			Assert::AreEqual(copies.back().m_name, objects.back().m_name);
+		}
+
+		TEST_METHOD(Benchmark_snapshot_map_vs_load_vs_deserialize)
+		{
+			constexpr size_t recordCount{ 1000000 };
+			constexpr size_t passes{ 10 };
+
+			std::vector<SnapshotRecord> records(recordCount);
+			for (size_t i = 0; i < recordCount; ++i) records[i] = { 1.0f, 2.0f, 3.0f, static_cast<int>(i), i * 0.5 };
+
+			auto snapshotPath{ std::filesystem::temp_directory_path() / "RTTRBenchmarks_snapshot.bin" };
+			auto binaryPath{ std::filesystem::temp_directory_path() / "RTTRBenchmarks_binary.bin" };
+			Assert::IsTrue(RTTR::writeSnapshot(snapshotPath, std::span<const SnapshotRecord>{ records }));
+
+			RTTR::BinaryWriter writer{};
+			RTTR::serialize(records, writer);
+			std::ofstream{ binaryPath, std::ios::binary }.write(reinterpret_cast<const char*>(writer.data()), writer.size());
+
+			auto measure{ [](const std::string& name, auto func)
+				{
+					size_t sink{ 0 };
+					auto begin{ std::chrono::steady_clock::now() };
+					for (size_t pass = 0; pass < passes; ++pass) sink += func();
+					auto end{ std::chrono::steady_clock::now() };
+
+					auto ms{ std::chrono::duration<double, std::milli>(end - begin).count() / passes };
+					Logger::WriteMessage((name + ": " + std::to_string(ms) + " ms/load (" + std::to_string(sink) + ")").c_str());
+				} };
+
+			measure("Snapshot::open + view", [&]
+				{
+					RTTR::Snapshot snapshot{};
+					snapshot.open(snapshotPath);
+					auto view{ snapshot.view<SnapshotRecord>() };
+					return static_cast<size_t>(view[view.size() / 2].m_id);
+				});
+
+			std::vector<SnapshotRecord> loaded{};
+			measure("Snapshot::open + load", [&]
+				{
+					RTTR::Snapshot snapshot{};
+					snapshot.open(snapshotPath);
+					snapshot.load(loaded);
+					return static_cast<size_t>(loaded[loaded.size() / 2].m_id);
+				});
+
+			std::vector<unsigned char> buffer{};
+			measure("read file + RTTR::deserialize", [&]
+				{
+					std::ifstream file{ binaryPath, std::ios::binary };
+					buffer.resize(std::filesystem::file_size(binaryPath));
+					file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+
+					RTTR::BinaryReader reader{ buffer.data(), buffer.size() };
+					RTTR::deserialize(loaded, reader);
+					return static_cast<size_t>(loaded[loaded.size() / 2].m_id);
+				});
+
+			std::filesystem::remove(snapshotPath);
+			std::filesystem::remove(binaryPath);
+		}
+
+		TEST_METHOD(Benchmark_json_plan_vs_reflective)
+		{
+			constexpr size_t objectCount{ 10000 };
+			constexpr size_t passes{ 20 };
+
+			std::vector<BFakeObject> objects(objectCount);
+			for (size_t i = 0; i < objectCount; ++i)
+			{
+				objects[i].m_x = i * 0.25f;
+				objects[i].m_id = static_cast<int>(i);
+				objects[i].m_name = "object" + std::to_string(i);
+			}
+
+			auto throughput{ [](const std::string& name, auto func)
+				{
+					auto begin{ std::chrono::steady_clock::now() };
+					size_t bytes{ 0 };
+					for (size_t pass = 0; pass < passes; ++pass) bytes += func();
+					auto end{ std::chrono::steady_clock::now() };
+
+					auto seconds{ std::chrono::duration<double>(end - begin).count() };
+					Logger::WriteMessage((name + ": " + std::to_string(bytes / seconds / (1024 * 1024)) + " MB/s").c_str());
+				} };
+
+			RTTR::JsonWriter writer{};
+			throughput("RTTR::toJson", [&]
+				{
+					writer.clear();
+					RTTR::toJson(objects, writer);
+					return writer.size();
+				});
+
+			//ԱֲңvalueNormalMemberƺƴַ
+			std::string text{};
+			throughput("reflective toJson", [&]
+				{
+					text.clear();
+					text += '[';
+					for (auto& object : objects)
+					{
+						if (text.size() > 1) text += ',';
+						text += '{';
+						for (auto name : RTTR::RTTRInfo::info("BFakeObject")->normalMemberNames())
+						{
+							if (text.back() != '{') text += ',';
+							text += "\"" + std::string{ name } + "\":";
+							if (name == "m_id") text += std::to_string(RTTR::valueNormalMember<int>(&object, "BFakeObject", name));
+							else if (name == "m_weight") text += std::to_string(RTTR::valueNormalMember<double>(&object, "BFakeObject", name));
+							else if (name == "m_name") text += "\"" + RTTR::valueNormalMember<std::string>(&object, "BFakeObject", name) + "\"";
+							else text += std::to_string(RTTR::valueNormalMember<float>(&object, "BFakeObject", name));
+						}
+						text += '}';
+					}
+					text += ']';
+					return text.size();
+				});
+
+			std::vector<BFakeObject> copies{};
+			throughput("RTTR::fromJson", [&]
+				{
+					RTTR::fromJson(copies, writer.view());
+					return writer.size();
+				});
+
+			//ͬĽstd::mapҳԱ
+			std::map<std::string, const RTTR::NormalMemberInfo*, std::less<>> members{};
+			for (const auto& member : RTTR::RTTRInfo::info("BFakeObject")->normalMembers()) members.emplace(member.name, &member);
+			throughput("map lookup fromJson", [&]
+				{
+					RTTR::JsonReader reader{ writer.view() };
+					copies.clear();
+					RTTR::readJsonArray(reader, [&]
+						{
+							auto& object{ copies.emplace_back() };
+							if (!reader.consume('{')) return false;
+							do
+							{
+								std::string_view key{};
+								if (!reader.readKey(key) || !reader.consume(':')) return false;
+								auto member{ members.find(key) };
+								if (member == members.end()) return false;
+								if (!member->second->info->readJson(reinterpret_cast<unsigned char*>(&object) + member->second->offset, reader)) return false;
+							}
+							while (reader.consume(','));
+							return reader.consume('}');
+						});
+					return writer.size();
+				});
+			Assert::AreEqual(copies.back().m_name, objects.back().m_name);
+		}
+
+		TEST_METHOD(Benchmark_isA_flattened_vs_superclassWalk)
+		{
+			//̳йϵRTTRLibTests.cppеShapeLeaf
+			auto leaf{ RTTR::RTTRInfo::info("ShapeLeaf") };
+			auto base{ RTTR::RTTRInfo::info("ShapeTagged") };
+			auto unrelated{ RTTR::RTTRInfo::info("BFakeObject") };
+			Assert::IsNotNull(leaf);
+
+			//ֱӸݹ
+			auto walk{ [](auto& self, const RTTR::RTTRInfo* info, RTTR::TypeId id) -> bool
+				{
+					if (info->id() == id) return true;
+					for (const auto& superclass : info->superclasses())
+						if (self(self, superclass.info, id)) return true;
+					return false;
+				} };
+
+			benchmark("RTTRInfo::isA (ancestor)", s_iterations, [&] { return leaf->isA(base) + leaf->isA(unrelated); });
+			benchmark("superclass walk (ancestor)", s_iterations, [&] { return walk(walk, leaf, base->id()) + walk(walk, leaf, unrelated->id()); });
+
+			benchmark("RTTRInfo::inheritedNormalMember", s_iterations, [&] { return static_cast<size_t>(leaf->inheritedNormalMember("m_tag").info->offset); });
+			auto walkMember{ [](auto& self, const RTTR::RTTRInfo* info, std::string_view name) -> const RTTR::NormalMemberInfo*
+				{
+					if (auto member{ info->normalMember(name) }) return member;
+					for (const auto& superclass : info->superclasses())
+						if (auto member{ self(self, superclass.info, name) }) return member;
+					return nullptr;
+				} };
+			benchmark("superclass walk normalMember", s_iterations, [&] { return static_cast<size_t>(walkMember(walkMember, leaf, "m_tag")->offset); });
+		}
+
+		TEST_METHOD(Benchmark_create_pooled_vs_heap_vs_new)
+		{
+			auto pooled{ RTTR::RTTRInfo::info("PooledRecord") };
+			auto heap{ RTTR::RTTRInfo::info("HeapRecord") };
+			Assert::IsNotNull(pooled->pool());
+
+			//ȶн׶עѶᣬҹ캯
+			RTTR::freeze();
+			benchmark("RTTRInfo::create/destroy (pool)", s_iterations, [pooled]
+				{
+					auto object{ pooled->create() };
+					pooled->destroy(object);
+					return reinterpret_cast<uintptr_t>(object) & 1;
+				});
+			benchmark("RTTRInfo::create/destroy (heap)", s_iterations, [heap]
+				{
+					auto object{ heap->create() };
+					heap->destroy(object);
+					return reinterpret_cast<uintptr_t>(object) & 1;
+				});
+			benchmark("new/delete", s_iterations, []
+				{
+					auto object{ new HeapRecord{} };
+					auto result{ reinterpret_cast<uintptr_t>(object) & 1 };
+					delete object;
+					return result;
+				});
+
+			//٣練лһͼ
+			constexpr size_t batch{ 1000 };
+			std::vector<void*> objects(batch);
+			benchmark("RTTRInfo::create x1000 (pool)", s_iterations / batch, [&]
+				{
+					for (auto& object : objects) object = pooled->create();
+					for (auto object : objects) pooled->destroy(object);
+					return batch;
+				});
+			benchmark("RTTRInfo::create x1000 (heap)", s_iterations / batch, [&]
+				{
+					for (auto& object : objects) object = heap->create();
+					for (auto object : objects) heap->destroy(object);
+					return batch;
+				});
+			benchmark("new x1000", s_iterations / batch, [&]
+				{
+					for (auto& object : objects) object = new HeapRecord{};
+					for (auto object : objects) delete static_cast<HeapRecord*>(object);
+					return batch;
+				});
+			RTTR::thaw();
+		}
+
+		TEST_METHOD(Benchmark_for_each_member_vs_handwritten_vs_runtime)
+		{
+			std::vector<BFakeObject> objects(1000);
+			for (size_t i = 0; i < objects.size(); ++i)
+			{
+				objects[i].m_x = static_cast<float>(i);
+				objects[i].m_id = static_cast<int>(i);
+			}
+
+			//ֵԱͣڱӦдͬĴ
+			benchmark("RTTR::for_each_member x1000", s_iterations / 100, [&]
+				{
+					double sum{ 0.0 };
+					for (const auto& object : objects)
+					{
+						RTTR::for_each_member(object, [&sum](const auto&, const auto& value)
+							{
+								if constexpr (std::is_arithmetic_v<std::remove_cvref_t<decltype(value)>>) sum += value;
+							});
+					}
+					return static_cast<size_t>(sum);
+				});
+			benchmark("handwritten x1000", s_iterations / 100, [&]
+				{
+					double sum{ 0.0 };
+					for (const auto& object : objects)
+					{
+						sum += object.m_x;
+						sum += object.m_y;
+						sum += object.m_z;
+						sum += object.m_id;
+						sum += object.m_weight;
+					}
+					return static_cast<size_t>(sum);
+				});
+
+			//ڱֻԱͷ
+			auto info{ RTTR::RTTRInfo::info("BFakeObject") };
+			benchmark("RTTRInfo::normalMembers x1000", s_iterations / 100, [&]
+				{
+					double sum{ 0.0 };
+					for (const auto& object : objects)
+					{
+						for (const auto& member : info->normalMembers())
+						{
+							if (RTTR::isType<float>(member.info)) sum += member.cref<float>(&object);
+							else if (RTTR::isType<int>(member.info)) sum += member.cref<int>(&object);
+							else if (RTTR::isType<double>(member.info)) sum += member.cref<double>(&object);
+						}
+					}
+					return static_cast<size_t>(sum);
+				});
+		}
+	};
+}
@@ -1,15 +1,342 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 #include "RTTR.h"
 #include "CppUnitTest.h"
 
 #include "FakeObject/AFakeObject.h"
+#include "FakeObject/BFakeObject.h"
+#include "FakeObject/CFakeObject.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
+//ǰ߳̾RTTRInfo::allocate()ͨöѷĴ֤̬·
+static thread_local size_t t_heapAllocations{ 0 };
+
+static void countHeapAllocation(const RTTR::RTTRInfo&, size_t)
+{
+	++t_heapAllocations;
+}
+
+template<int N>
+struct StressObject
+{
+	std::string m_string{};
+};
+RTTR_REGISTER(StressObject<0>)
+RTTR_REGISTER(StressObject<1>)
+RTTR_REGISTER(StressObject<2>)
+RTTR_REGISTER(StressObject<3>)
+RTTR_REGISTER(StressObject<4>)
+
+//plan()õݣϢڵĲλ
+template<int N>
+struct CountingPlan
+{
+	static CountingPlan build(const RTTR::RTTRInfo& info) { return { N, info.size() }; }
+
+	int index;
+	size_t size;
+};
+
+template<int... N>
+static bool plansDistinct(const RTTR::RTTRInfo& info, std::integer_sequence<int, N...>)
+{
+	return ((info.plan<CountingPlan<N>>(&CountingPlan<N>::build).index == N && &info.plan<CountingPlan<N>>(&CountingPlan<N>::build) == &info.plan<CountingPlan<N>>(&CountingPlan<N>::build)) && ...);
+}
+
+//ͬһݼ¼汾V2ɾm_xm_zm_idm_y˳
+struct SnapshotV1
+{
+	int m_id{ 0 };
+	float m_x{ 0.0f };
+	float m_y{ 0.0f };
+};
+RTTR_REGISTER(SnapshotV1)
+
+struct SnapshotV2
+{
+	float m_y{ 0.0f };
+	int m_id{ 0 };
+	double m_z{ -1.0 };
+};
+RTTR_REGISTER(SnapshotV2)
+
+//Ƕ׵Ŀƽͣдպıֶα
+struct SnapshotNested
+{
+	int m_a{ 0 };
+	int m_b{ 0 };
+};
+RTTR_REGISTER(SnapshotNested)
+
+struct SnapshotOuter
+{
+	int m_id{ 0 };
+	SnapshotNested m_nested{};
+};
+RTTR_REGISTER(SnapshotOuter)
+
+//̳йϵShapeLeaf -> ShapeDerived -> (ShapeBase, ShapeTagged)ShapeDerived::m_idShapeBase::m_id
+struct ShapeBase
+{
+	int m_id{ 1 };
+	int id() const { return m_id; }
+	static inline int s_count{ 0 };
+};
+RTTR_REGISTER(ShapeBase)
+
+struct ShapeTagged
+{
+	double m_tag{ 2.0 };
+	void tag(double value) { m_tag = value; }
+};
+RTTR_REGISTER(ShapeTagged)
+
+struct ShapeDerived : ShapeBase, ShapeTagged
+{
+	int m_id{ 3 };
+};
+RTTR_REGISTER(ShapeDerived)
+
+struct ShapeLeaf : ShapeDerived
+{
+	float m_leaf{ 4.0f };
+};
+RTTR_REGISTER(ShapeLeaf)
+
+//̳μ̳Уֻжϼ̳йϵ
+struct ShapeVirtual : virtual ShapeBase {};
+RTTR_REGISTER(ShapeVirtual)
+
+struct ShapeLeft : ShapeBase {};
+RTTR_REGISTER(ShapeLeft)
+
+struct ShapeRight : ShapeBase {};
+RTTR_REGISTER(ShapeRight)
+
+struct ShapeDiamond : ShapeLeft, ShapeRight {};
+RTTR_REGISTER(ShapeDiamond)
+
+//Աɲڲѯ֮ע
+struct ShapeLate : ShapeBase, ShapeTagged
+{
+	int m_late{ 0 };
+};
+RTTR_REGISTER(ShapeLate)
+
+RTTR_REGISTRATION(ShapeBase)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(ShapeBase, RTTR::Public, m_id);
+	RTTR_REGISTER_STATIC_MEMBER(ShapeBase, RTTR::Public, s_count);
+	RTTR_REGISTER_CONST_METHOD(ShapeBase, RTTR::Public, int, id);
+}
+
+RTTR_REGISTRATION(ShapeTagged)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(ShapeTagged, RTTR::Public, m_tag);
+	RTTR_REGISTER_NORMAL_METHOD(ShapeTagged, RTTR::Public, void, tag, double);
+}
+
+RTTR_REGISTRATION(ShapeDerived)
+{
+	RRTR_REGISTER_SUPERCLASS(ShapeDerived, RTTR::Public, ShapeBase);
+	RRTR_REGISTER_SUPERCLASS(ShapeDerived, RTTR::Public, ShapeTagged);
+	RTTR_REGISTER_NORMAL_MEMBER(ShapeDerived, RTTR::Public, m_id);
+}
+
+RTTR_REGISTRATION(ShapeLeaf)
+{
+	RRTR_REGISTER_SUPERCLASS(ShapeLeaf, RTTR::Public, ShapeDerived);
+	RTTR_REGISTER_NORMAL_MEMBER(ShapeLeaf, RTTR::Public, m_leaf);
+}
+
+RTTR_REGISTRATION(ShapeVirtual)
+{
+	RRTR_REGISTER_SUPERCLASS(ShapeVirtual, RTTR::Interview(RTTR::Public | RTTR::Virtual), ShapeBase);
+}
+
+RTTR_REGISTRATION(ShapeLeft)
+{
+	RRTR_REGISTER_SUPERCLASS(ShapeLeft, RTTR::Public, ShapeBase);
+}
+
+RTTR_REGISTRATION(ShapeRight)
+{
+	RRTR_REGISTER_SUPERCLASS(ShapeRight, RTTR::Public, ShapeBase);
+}
+
+RTTR_REGISTRATION(ShapeDiamond)
+{
+	RRTR_REGISTER_SUPERCLASS(ShapeDiamond, RTTR::Public, ShapeLeft);
+	RRTR_REGISTER_SUPERCLASS(ShapeDiamond, RTTR::Public, ShapeRight);
+}
+
+//ԱƫƲ󣺳ûĬϹ캯ҲעͨԱ
+struct ShapeAbstract
+{
+	virtual ~ShapeAbstract() = default;
+	virtual int area() const = 0;
+	int m_sides{ 4 };
+};
+RTTR_REGISTER(ShapeAbstract)
+
+struct ShapeFixed
+{
+	explicit ShapeFixed(int sides) : m_sides(sides) {}
+	double m_scale{ 1.0 };
+	int m_sides;
+};
+RTTR_REGISTER(ShapeFixed)
+
+RTTR_REGISTRATION(ShapeAbstract)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(ShapeAbstract, RTTR::Public, m_sides);
+}
+
+RTTR_REGISTRATION(ShapeFixed)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(ShapeFixed, RTTR::Public, m_scale);
+	RTTR_REGISTER_NORMAL_MEMBER(ShapeFixed, RTTR::Public, m_sides);
+}
+
+//زõͣmallocĬ϶
+struct alignas(64) PooledObject
+{
+	PooledObject(int value, std::string name) : m_value(value), m_name(std::move(name)) { ++s_live; }
+	~PooledObject() { --s_live; }
+
+	int m_value{ 0 };
+	std::string m_name{};
+	static inline std::atomic<int> s_live{ 0 };
+};
+RTTR_REGISTER(PooledObject)
+
+RTTR_REGISTRATION(PooledObject)
+{
+	RTTR_REGISTER_CONSTRUCTOR(PooledObject, RTTR::Public, int, std::string);
+	RTTR_REGISTER_POOL(PooledObject, 16);
+}
+
+//ӳעõͣע¼ִдֻڶӦĲвѯ
+struct LazyObject
+{
+	int m_value{ 0 };
+	static inline int s_registrations{ 0 };
+};
+RTTR_REGISTER(LazyObject)
+
+RTTR_REGISTRATION(LazyObject)
+{
+	++LazyObject::s_registrations;
+	RTTR_REGISTER_NORMAL_MEMBER(LazyObject, RTTR::Public, m_value);
+
+	//עвѯٴִע
+	RTTR::RealRTTRInfo<LazyObject>::instance()->normalMembers();
+}
+
+//עִһ͵ע飬ֻڶӦĲвѯ
+struct LazyInner
+{
+	int m_value{ 0 };
+};
+RTTR_REGISTER(LazyInner)
+
+struct LazyOuter
+{
+	LazyInner m_inner{};
+};
+RTTR_REGISTER(LazyOuter)
+
+RTTR_REGISTRATION(LazyInner)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(LazyInner, RTTR::Public, m_value);
+}
+
+RTTR_REGISTRATION(LazyOuter)
+{
+	RTTR::Registration<LazyInner>::once();
+	RTTR_REGISTER_NORMAL_MEMBER(LazyOuter, RTTR::Public, m_inner);
+}
+
+//õͣӲѯ
+struct LazyFrozenObject
+{
+	int m_value{ 0 };
+	static inline int s_registrations{ 0 };
+};
+RTTR_REGISTER(LazyFrozenObject)
+
+RTTR_REGISTRATION(LazyFrozenObject)
+{
+	++LazyFrozenObject::s_registrations;
+	RTTR_REGISTER_NORMAL_MEMBER(LazyFrozenObject, RTTR::Public, m_value);
+}
+
+//ٲõͣm_hpͨԼsetterд
+struct TrackedObject
+{
+	void setHp(int hp) { RTTR::setTracked<&TrackedObject::m_hp>(*this, hp); }
+
+	int m_hp{ 100 };
+	float m_x{ 0.0f };
+	std::string m_name{};
+	BFakeObject m_child{};
+	RTTR::DirtyBits<> m_dirty{};
+};
+RTTR_REGISTER(TrackedObject)
+
+RTTR_REGISTRATION(TrackedObject)
+{
+	RTTR_REGISTER_DIRTY_BITS(TrackedObject, m_dirty);
+	RTTR_REGISTER_NORMAL_MEMBER(TrackedObject, RTTR::Public, m_name);
+	RTTR_REGISTER_NORMAL_MEMBER(TrackedObject, RTTR::Public, m_hp);
+	RTTR_REGISTER_NORMAL_MEMBER(TrackedObject, RTTR::Public, m_x);
+	RTTR_REGISTER_NORMAL_MEMBER(TrackedObject, RTTR::Public, m_child);
+}
+
+RTTR_REGISTRATION(SnapshotV1)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotV1, RTTR::Public, m_id);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotV1, RTTR::Public, m_x);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotV1, RTTR::Public, m_y);
+}
+
+RTTR_REGISTRATION(SnapshotV2)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotV2, RTTR::Public, m_y);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotV2, RTTR::Public, m_id);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotV2, RTTR::Public, m_z);
+}
+
+RTTR_REGISTRATION(SnapshotNested)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotNested, RTTR::Public, m_a);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotNested, RTTR::Public, m_b);
+}
+
+RTTR_REGISTRATION(SnapshotOuter)
+{
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotOuter, RTTR::Public, m_id);
+	RTTR_REGISTER_NORMAL_MEMBER(SnapshotOuter, RTTR::Public, m_nested);
+}
+
 namespace RTTRLibTests
 {
 	TEST_MODULE_INITIALIZE(TestModuleInitialize)
 	{
 		registerAFakeObject();
+		registerBFakeObject();
+		registerCFakeObject();
 	}
 
 	TEST_CLASS(RTTRLibTests)
@@ -17,12 +344,12 @@ namespace RTTRLibTests
 	public:
 		TEST_METHOD(AFakeObject_TypeInfo_info_notNull)
 		{
-			Assert::IsNotNull(RTTR::RTTRInfo::info("class AFakeObject"));
+			Assert::IsNotNull(RTTR::RTTRInfo::info("AFakeObject"));
 		}
 
 		TEST_METHOD(AFakeObject_RTTR_valueStaticMember_AreEqual)
 		{
-			auto string{ RTTR::valueStaticMember<std::string>("class AFakeObject", "s_string") };
+			auto string{ RTTR::valueStaticMember<std::string>("AFakeObject", "s_string") };
 			Assert::AreEqual(string, std::string{ "AFakeObject::s_string" });
 			Logger::WriteMessage(string.c_str());
 		}
@@ -30,14 +357,15 @@ namespace RTTRLibTests
 		TEST_METHOD(AFakeObject_RTTR_valueNormalMember_AreEqual)
 		{
 			auto object{ createAFakeObject() };
-			auto string{ RTTR::valueNormalMember<std::string>(object, "class AFakeObject", "m_string") };
+			auto string{ RTTR::valueNormalMember<std::string>(object, "AFakeObject", "m_string") };
 			Assert::AreEqual(string, std::string{ "AFakeObject::m_string" });
 			Logger::WriteMessage(string.c_str());
+			RTTR::destroy(object, "AFakeObject");
 		}
 
 		TEST_METHOD(AFakeObject_RTTR_invokeStaticMethod_AreEqual)
 		{
-			auto string{ RTTR::invokeStaticMethod<std::string(*)()>("class AFakeObject", "staticFunc") };
+			auto string{ RTTR::invokeStaticMethod<std::string(*)()>("AFakeObject", "staticFunc") };
 			Assert::AreEqual(string, std::string{ "AFakeObject::staticFunc()" });
 			Logger::WriteMessage(string.c_str());
 		}
@@ -45,17 +373,1326 @@ namespace RTTRLibTests
 		TEST_METHOD(AFakeObject_RTTR_invokeNormalMethod_AreEqual)
 		{
 			auto object{ createAFakeObject() };
-			auto string{ RTTR::invokeNormalMethod<std::string(AFakeObject::*)()>(object, "class AFakeObject", "normalFunc") };
+			auto string{ RTTR::invokeNormalMethod<std::string(AFakeObject::*)()>(object, "AFakeObject", "normalFunc") };
 			Assert::AreEqual(string, std::string{ "AFakeObject::normalFunc()" });
 			Logger::WriteMessage(string.c_str());
+			RTTR::destroy(object, "AFakeObject");
 		}
 
 		TEST_METHOD(AFakeObject_RTTR_invokeConstMethod_AreEqual)
 		{
 			auto object{ createAFakeObject() };
-			auto string{ RTTR::invokeConstMethod<std::string(AFakeObject::*)() const>(object, "class AFakeObject", "constFunc") };
+			auto string{ RTTR::invokeConstMethod<std::string(AFakeObject::*)() const>(object, "AFakeObject", "constFunc") };
 			Assert::AreEqual(string, std::string{ "AFakeObject::constFunc() const" });
 			Logger::WriteMessage(string.c_str());
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_staticMethodHandle_AreEqual)
+		{
+			auto handle{ RTTR::staticMethodHandle<std::string(*)()>("AFakeObject", "staticFunc") };
+			Assert::IsTrue(static_cast<bool>(handle));
+			Assert::AreEqual(handle.invoke(), std::string{ "AFakeObject::staticFunc()" });
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_normalMethodHandle_AreEqual)
+		{
+			auto object{ createAFakeObject() };
+			auto handle{ RTTR::normalMethodHandle<std::string(AFakeObject::*)()>("AFakeObject", "normalFunc") };
+			Assert::IsTrue(static_cast<bool>(handle));
+			Assert::AreEqual(handle.invoke(object), std::string{ "AFakeObject::normalFunc()" });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_constMethodHandle_AreEqual)
+		{
+			auto object{ createAFakeObject() };
+			auto handle{ RTTR::constMethodHandle<std::string(AFakeObject::*)() const>("AFakeObject", "constFunc") };
+			Assert::IsTrue(static_cast<bool>(handle));
+			Assert::AreEqual(handle.invoke(object), std::string{ "AFakeObject::constFunc() const" });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_memberHandle_AreEqual)
+		{
+			auto object{ createAFakeObject() };
+			auto staticHandle{ RTTR::staticMemberHandle<std::string>("AFakeObject", "s_string") };
+			auto normalHandle{ RTTR::normalMemberHandle<std::string>("AFakeObject", "m_string") };
+			Assert::AreEqual(staticHandle.value(), std::string{ "AFakeObject::s_string" });
+			Assert::AreEqual(normalHandle.value(object), std::string{ "AFakeObject::m_string" });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_methodHandle_mismatch_isEmpty)
+		{
+			Assert::IsFalse(static_cast<bool>(RTTR::staticMethodHandle<std::string(*)(std::string)>("AFakeObject", "staticFunc")));
+			Assert::IsFalse(static_cast<bool>(RTTR::staticMethodHandle<std::string(*)()>("AFakeObject", "missingFunc")));
+			Assert::IsFalse(static_cast<bool>(RTTR::normalMemberHandle<std::string>("AFakeObject", "m_missing")));
+		}
+
+		TEST_METHOD(AFakeObject_RTTRInfo_queries_returnViews)
+		{
+			registerAFakeObject();
+			auto info{ RTTR::RTTRInfo::info("AFakeObject") };
+
+			Assert::IsTrue(info->normalMember("m_string") == info->normalMember("m_string"));
+			Assert::IsTrue(info->normalMethod("normalFunc").data() == info->normalMethod("normalFunc").data());
+			Assert::AreEqual(info->normalMethod("normalFunc").size(), size_t{ 2 });
+			Assert::IsTrue(info->constMethod("missingFunc").empty());
+			Assert::IsNull(info->staticMember("s_missing"));
+
+			const auto& names{ info->normalMemberNames() };
+			Assert::IsTrue(std::find(names.begin(), names.end(), "m_string") != names.end());
+		}
+
+		TEST_METHOD(AFakeObject_RTTRInfo_typeId_AreEqual)
+		{
+			constexpr auto id{ RTTR::typeId("AFakeObject") };
+			auto info{ RTTR::RTTRInfo::info(id) };
+			Assert::IsNotNull(info);
+			Assert::IsTrue(info == RTTR::RTTRInfo::info(std::string_view{ "AFakeObject" }));
+			Assert::IsTrue(info->id() == id);
+			Assert::IsTrue(info->name() == "AFakeObject");
+			Assert::IsNotNull(RTTR::RTTRInfo::info("std::string"));
+			Assert::IsNull(RTTR::RTTRInfo::info("class AFakeObject"));
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_invokeNormalMethod_overload_AreEqual)
+		{
+			auto object{ createAFakeObject() };
+			auto string{ RTTR::invokeNormalMethod<std::string(AFakeObject::*)(std::string)>(object, "AFakeObject", "normalFunc", std::string{ "suffix" }) };
+			Assert::AreEqual(string, std::string{ "AFakeObject::normalFunc(suffix)" });
+
+			auto handle{ RTTR::normalMethodHandle<std::string(AFakeObject::*)(std::string)>("AFakeObject", "normalFunc") };
+			Assert::AreEqual(handle.invoke(object, "handle"), std::string{ "AFakeObject::normalFunc(handle)" });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_invokeMethod_mismatch_Throws)
+		{
+			auto object{ createAFakeObject() };
+			Assert::ExpectException<std::bad_function_call>([] { RTTR::invokeStaticMethod<std::string(*)(std::string)>("AFakeObject", "staticFunc", std::string{}); });
+			Assert::ExpectException<std::bad_function_call>([object] { RTTR::invokeNormalMethod<std::string(AFakeObject::*)()>(object, "AFakeObject", "missingFunc"); });
+			Assert::ExpectException<std::bad_function_call>([object] { RTTR::invokeConstMethod<std::string(AFakeObject::*)() const>(object, "MissingObject", "constFunc"); });
+
+			//ǩͬ಻ͬĺͲܵ
+			const auto& methodInfo{ *RTTR::RTTRInfo::info("AFakeObject")->normalMethod("normalFunc", RTTR::signature_traits<std::string(AFakeObject::*)()>::value) };
+			Assert::ExpectException<std::bad_function_call>([&methodInfo] { methodInfo.invoke<std::string(BFakeObject::*)()>(static_cast<BFakeObject*>(nullptr)); });
+			Assert::ExpectException<std::bad_function_call>([object] { RTTR::invokeNormalMethod<std::string(BFakeObject::*)()>(object, "AFakeObject", "normalFunc"); });
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(AFakeObject_MethodInfo_call_AreEqual)
+		{
+			auto object{ createAFakeObject() };
+			auto info{ RTTR::RTTRInfo::info("AFakeObject") };
+
+			alignas(std::string) unsigned char ret[sizeof(std::string)];
+			info->staticMethod("staticFunc").front()->call(nullptr, nullptr, ret);
+			Assert::AreEqual(*reinterpret_cast<std::string*>(ret), std::string{ "AFakeObject::staticFunc()" });
+			std::destroy_at(reinterpret_cast<std::string*>(ret));
+
+			std::string suffix{ "dynamic" };
+			void* args[]{ &suffix };
+			auto methodInfo{ info->normalMethod("normalFunc", RTTR::signature_traits<std::string(AFakeObject::*)(std::string)>::value) };
+			Assert::IsNotNull(methodInfo);
+			methodInfo->call(object, args, ret);
+			Assert::AreEqual(*reinterpret_cast<std::string*>(ret), std::string{ "AFakeObject::normalFunc(dynamic)" });
+			Assert::AreEqual(suffix, std::string{ "dynamic" });
+			std::destroy_at(reinterpret_cast<std::string*>(ret));
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(Variant_copyMoveConvert_AreEqual)
+		{
+			RTTR::Variant empty{};
+			Assert::IsTrue(empty.empty());
+			Assert::IsTrue(RTTR::Variant{ empty }.empty());
+
+			RTTR::Variant number{ 42 };
+			Assert::IsTrue(number.is<int>());
+			Assert::IsNull(number.get<double>());
+			double real{ 0.0 };
+			Assert::IsTrue(number.to(real));
+			Assert::AreEqual(real, 42.0);
+			Assert::AreEqual(*RTTR::Variant{ 3.7 }.convert(RTTR::RTTRInfo::info("int")).get<int>(), 3);
+			Assert::IsTrue(RTTR::Variant{ std::string{} }.convert(RTTR::RTTRInfo::info("int")).empty());
+
+			//ַΪstd::stringƶֵ䣬ƶԴΪ
+			RTTR::Variant string{ "AFakeObject::m_string" };
+			Assert::IsTrue(string.is<std::string>());
+			auto copy{ string };
+			auto moved{ std::move(string) };
+			Assert::IsTrue(string.empty());
+			Assert::AreEqual(*copy.get<std::string>(), std::string{ "AFakeObject::m_string" });
+			Assert::AreEqual(*moved.get<std::string>(), std::string{ "AFakeObject::m_string" });
+
+			//ڲ洢ֵڶϣƶֻתָ
+			CFakeObject object{};
+			object.m_ids = { 1, 2, 3 };
+			static_assert(!RTTR::Variant::fitsInline<CFakeObject>);
+			RTTR::Variant large{ object };
+			auto address{ large.data() };
+			RTTR::Variant stolen{ std::move(large) };
+			Assert::IsTrue(stolen.data() == address);
+			Assert::AreEqual(stolen.get<CFakeObject>()->m_ids.size(), size_t{ 3 });
+			stolen = copy;
+			Assert::AreEqual(*stolen.get<std::string>(), std::string{ "AFakeObject::m_string" });
+		}
+
+		TEST_METHOD(Variant_invokeAndMembers_AreEqual)
+		{
+			auto object{ createAFakeObject() };
+
+			//ʵѡ
+			Assert::AreEqual(*RTTR::invokeMethod(object, "AFakeObject", "normalFunc").get<std::string>(), std::string{ "AFakeObject::normalFunc()" });
+			Assert::AreEqual(*RTTR::invokeMethod(object, "AFakeObject", "normalFunc", "variant").get<std::string>(), std::string{ "AFakeObject::normalFunc(variant)" });
+			Assert::AreEqual(*RTTR::invokeMethod(nullptr, "AFakeObject", "staticFunc").get<std::string>(), std::string{ "AFakeObject::staticFunc()" });
+			Assert::AreEqual(*RTTR::invokeMethod(object, "AFakeObject", "constFunc").get<std::string>(), std::string{ "AFakeObject::constFunc() const" });
+			Assert::ExpectException<std::bad_function_call>([object] { RTTR::invokeMethod(object, "AFakeObject", "normalFunc", 1.0); });
+			Assert::ExpectException<std::bad_function_call>([] { RTTR::invokeMethod(nullptr, "AFakeObject", "normalFunc"); });
+
+			//תvoidسvoidVariant
+			ShapeLeaf leaf{};
+			auto tagged{ RTTR::RTTRInfo::info("ShapeTagged") };
+			auto result{ RTTR::invokeMethod(static_cast<ShapeTagged*>(&leaf), "ShapeTagged", "tag", 5) };
+			Assert::IsTrue(result.info() == RTTR::RTTRInfo::info("void"));
+			Assert::AreEqual(leaf.m_tag, 5.0);
+			Assert::IsTrue(tagged->normalMethod("tag").front()->call(&leaf, {}).empty());
+
+			//Աؼ̳йϵңͨԱȣתд
+			Assert::AreEqual(*RTTR::getMember(&leaf, "ShapeLeaf", "m_tag").get<double>(), 5.0);
+			Assert::IsTrue(RTTR::setMember(&leaf, "ShapeLeaf", "m_id", 9.5));
+			Assert::AreEqual(leaf.ShapeDerived::m_id, 9);
+			Assert::IsTrue(RTTR::setMember(nullptr, "ShapeBase", "s_count", 7));
+			Assert::AreEqual(ShapeBase::s_count, 7);
+			Assert::IsFalse(RTTR::setMember(object, "AFakeObject", "m_string", 1));
+			Assert::IsTrue(RTTR::setMember(object, "AFakeObject", "m_string", "moved"));
+			Assert::AreEqual(object->m_string, std::string{ "moved" });
+			Assert::IsTrue(RTTR::getMember(object, "AFakeObject", "m_missing").empty());
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(Variant_dynamicInvoke_noHeapAllocation)
+		{
+			ShapeLeaf leaf{};
+			auto base{ RTTR::RTTRInfo::info("ShapeBase") };
+			auto id{ base->constMethod("id").front() };
+			RTTR::Variant args[]{ 3, std::string{ "short" } };
+
+			//Ԥȣִע鲢̳б
+			RTTR::invokeMethod(static_cast<ShapeTagged*>(&leaf), "ShapeTagged", "tag", args[0]);
+			RTTR::getMember(&leaf, "ShapeLeaf", "m_leaf");
+
+			auto hook{ RTTR::setAllocationHook(&countHeapAllocation) };
+			auto allocations{ t_heapAllocations };
+			auto result{ RTTR::invokeMethod(static_cast<ShapeTagged*>(&leaf), "ShapeTagged", "tag", std::span<const RTTR::Variant>{ args, 1 }) };
+			auto value{ id->call(static_cast<ShapeBase*>(&leaf), {}) };
+			auto leafValue{ RTTR::getMember(&leaf, "ShapeLeaf", "m_leaf") };
+			RTTR::setMember(&leaf, "ShapeLeaf", "m_leaf", args[0]);
+			RTTR::Variant copy{ args[1] };
+			Assert::AreEqual(t_heapAllocations - allocations, size_t{ 0 });
+
+			//ڲ洢ֵͨöѷ䣬ص
+			auto heap{ base->allocate() };
+			Assert::AreEqual(t_heapAllocations - allocations, size_t{ 1 });
+			base->deallocate(heap);
+			RTTR::setAllocationHook(hook);
+
+			Assert::AreEqual(leaf.m_tag, 3.0);
+			Assert::AreEqual(*value.get<int>(), 1);
+			Assert::AreEqual(*leafValue.get<float>(), 4.0f);
+			Assert::AreEqual(leaf.m_leaf, 3.0f);
+			Assert::IsTrue(result.is<void>());
+		}
+
+		TEST_METHOD(ShapeBase_invokeBatch_inlineAndPool_AreEqual)
+		{
+			using Id = int (ShapeBase::*)() const;
+			using Tag = void (ShapeTagged::*)(double);
+
+			std::vector<ShapeLeaf> leaves(1000);
+			std::vector<void*> bases{};
+			std::vector<void*> tagged{};
+			for (size_t i = 0; i < leaves.size(); ++i)
+			{
+				leaves[i].ShapeBase::m_id = static_cast<int>(i);
+				bases.push_back(static_cast<ShapeBase*>(&leaves[i]));
+				tagged.push_back(static_cast<ShapeTagged*>(&leaves[i]));
+			}
+
+			//ֻһ
+			auto id{ RTTR::RTTRInfo::info("ShapeBase")->constMethod("id", RTTR::signature_traits<Id>::value) };
+			auto tag{ RTTR::RTTRInfo::info("ShapeTagged")->normalMethod("tag", RTTR::signature_traits<Tag>::value) };
+			Assert::IsNotNull(id);
+			Assert::IsNotNull(tag);
+
+			RTTR::ThreadPool pool{ 4 };
+			std::vector<int> inlineIds(bases.size());
+			std::vector<int> pooledIds(bases.size());
+			RTTR::invokeBatch<Id>(*id, bases, inlineIds.data(), nullptr);
+			RTTR::invokeBatch<Id>(*id, bases, pooledIds.data(), &pool);
+			RTTR::invokeBatch<Tag>(*tag, tagged, nullptr, &pool, 6.5);
+			for (size_t i = 0; i < leaves.size(); ++i)
+			{
+				Assert::AreEqual(inlineIds[i], static_cast<int>(i));
+				Assert::AreEqual(pooledIds[i], static_cast<int>(i));
+				Assert::AreEqual(leaves[i].m_tag, 6.5);
+			}
+
+			//첽ͲĵдͬĽ
+			std::vector<int> asyncIds(bases.size());
+			RTTR::invokeBatchAsync<Id>(*id, bases, asyncIds.data(), pool).get();
+			Assert::IsTrue(asyncIds == inlineIds);
+
+			std::vector<int> erasedIds(bases.size());
+			RTTR::callBatch(*id, bases, nullptr, erasedIds.data(), &pool);
+			Assert::IsTrue(erasedIds == inlineIds);
+		}
+
+		TEST_METHOD(ThreadPool_parallelFor_nestedAndException)
+		{
+			RTTR::ThreadPool pool{ 2 };
+
+			//ڹ߳Ƕ׵òȴס
+			std::atomic<size_t> sum{ 0 };
+			pool.async([&pool, &sum]
+				{
+					pool.parallelFor(100, 1, [&pool, &sum](size_t begin, size_t end)
+						{
+							pool.parallelFor(10, 1, [&sum, begin, end](size_t, size_t) { sum += end - begin; });
+						});
+				}).get();
+			Assert::AreEqual(sum.load(), size_t{ 1000 });
+
+			//쳣ȫɵ߳׳̳֮߳Կʹ
+			Assert::ExpectException<std::runtime_error>([&pool]
+				{
+					pool.parallelFor(64, 1, [](size_t begin, size_t)
+						{
+							if (begin == 3) throw std::runtime_error{ "range" };
+						});
+				});
+			sum = 0;
+			pool.parallelFor(64, 4, [&sum](size_t begin, size_t end) { sum += end - begin; });
+			Assert::AreEqual(sum.load(), size_t{ 64 });
+		}
+
+		TEST_METHOD(RTTR_registry_concurrentRegister_thenFreeze)
+		{
+			RTTR::thaw();
+
+			using InfoGetter = RTTR::RTTRInfo* (*)();
+			static constexpr InfoGetter s_getters[]
+			{
+				[]() -> RTTR::RTTRInfo* { return RTTR::RealRTTRInfo<StressObject<0>>::instance(); },
+				[]() -> RTTR::RTTRInfo* { return RTTR::RealRTTRInfo<StressObject<1>>::instance(); },
+				[]() -> RTTR::RTTRInfo* { return RTTR::RealRTTRInfo<StressObject<2>>::instance(); },
+				[]() -> RTTR::RTTRInfo* { return RTTR::RealRTTRInfo<StressObject<3>>::instance(); },
+			};
+			constexpr int threadCount{ 8 };
+			constexpr int memberCount{ 500 };
+
+			std::atomic<int> failures{ 0 };
+			auto memberName{ [](int thread, int index) { return "m_" + std::to_string(thread) + "_" + std::to_string(index); } };
+
+			std::vector<std::thread> threads{};
+			for (int t = 0; t < threadCount; ++t)
+			{
+				threads.emplace_back([t, &failures, &memberName]
+					{
+						auto info{ s_getters[t % std::size(s_getters)]() };
+						for (int i = 0; i < memberCount; ++i)
+						{
+							auto name{ memberName(t, i) };
+							if (!info->registerNormalMember({ name, RTTR::Public, RTTR::RTTRInfo::info("std::string"), 0 })) ++failures;
+							if (nullptr == info->normalMember(name)) ++failures;
+							if (nullptr == RTTR::RTTRInfo::info(info->id())) ++failures;
+							if (nullptr == RTTR::RTTRInfo::info("AFakeObject")->normalMethod("normalFunc", RTTR::signature_traits<std::string(AFakeObject::*)()>::value)) ++failures;
+						}
+					});
+			}
+			for (auto& thread : threads) thread.join();
+			Assert::AreEqual(failures.load(), 0);
+
+			RTTR::freeze();
+			Assert::IsTrue(RTTR::frozen());
+
+			threads.clear();
+			for (int t = 0; t < threadCount; ++t)
+			{
+				threads.emplace_back([t, &failures, &memberName]
+					{
+						for (int i = 0; i < memberCount; ++i)
+						{
+							auto info{ RTTR::RTTRInfo::info(s_getters[t % std::size(s_getters)]()->name()) };
+							if (nullptr == info || nullptr == info->normalMember(memberName(t, i))) ++failures;
+							if (nullptr != RTTR::RTTRInfo::info("MissingObject")) ++failures;
+						}
+					});
+			}
+			for (auto& thread : threads) thread.join();
+			Assert::AreEqual(failures.load(), 0);
+
+			auto info{ RTTR::RealRTTRInfo<StressObject<0>>::instance() };
+			Assert::IsFalse(info->registerNormalMember({ "m_frozen", RTTR::Public, RTTR::RTTRInfo::info("std::string"), 0 }));
+			Assert::IsNull(info->normalMember("m_frozen"));
+
+			RTTR::thaw();
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_REGISTRATION_runsOnce)
+		{
+			auto info{ RTTR::RTTRInfo::info("AFakeObject") };
+			Assert::IsNotNull(info->normalMember("m_string"));
+			Assert::IsNotNull(info->constMethod("constFunc", RTTR::signature_traits<std::string(AFakeObject::*)() const>::value));
+
+			auto memberCount{ info->normalMemberNames().size() };
+			auto methodCount{ info->normalMethod("normalFunc").size() };
+			RTTR::destroy(createAFakeObject(), "AFakeObject");
+			registerAFakeObject();
+			Assert::AreEqual(info->normalMemberNames().size(), memberCount);
+			Assert::AreEqual(info->normalMethod("normalFunc").size(), methodCount);
+		}
+
+		TEST_METHOD(LazyObject_RTTR_REGISTRATION_runsOnFirstQuery)
+		{
+			//ֲͲִע飻ͬһеĲԿѶִйȫע
+			auto info{ RTTR::RTTRInfo::info("LazyObject") };
+			Assert::IsNotNull(info);
+			Assert::AreEqual(LazyObject::s_registrations, info->materialized() ? 1 : 0);
+
+			//ѯʱִֻһ
+			std::atomic<int> found{ 0 };
+			std::vector<std::thread> threads{};
+			for (int i = 0; i < 4; ++i)
+			{
+				threads.emplace_back([info, &found]
+					{
+						if (info->normalMember("m_value")) ++found;
+					});
+			}
+			for (auto& thread : threads) thread.join();
+
+			Assert::AreEqual(found.load(), 4);
+			Assert::AreEqual(LazyObject::s_registrations, 1);
+			Assert::IsTrue(info->materialized());
+
+			RTTR::materializeAll();
+			Assert::AreEqual(LazyObject::s_registrations, 1);
+			Assert::AreEqual(info->normalMemberNames().size(), size_t{ 1 });
+
+			//ǰִע飬Ĳѯ޸ͱ
+			RTTR::freeze();
+			auto frozen{ RTTR::RTTRInfo::info("LazyFrozenObject") };
+			Assert::IsTrue(frozen->materialized());
+			Assert::IsNotNull(frozen->normalMember("m_value"));
+			RTTR::thaw();
+			Assert::AreEqual(LazyFrozenObject::s_registrations, 1);
+		}
+
+		TEST_METHOD(LazyOuter_RTTR_REGISTRATION_onceRegistersOtherType)
+		{
+			//LazyOuterעLazyInnerִע飬Աᱻܾ
+			auto outer{ RTTR::RTTRInfo::info("LazyOuter") };
+			Assert::IsNotNull(outer->normalMember("m_inner"));
+
+			auto inner{ RTTR::RTTRInfo::info("LazyInner") };
+			Assert::AreEqual(inner->normalMembers().size(), size_t{ 1 });
+			Assert::IsNotNull(inner->normalMember("m_value"));
+		}
+
+		TEST_METHOD(RTTR_seal_lookupsMatchIndex)
+		{
+			RTTR::thaw();
+
+			//Ա㹻Žϣǰ߿Ѱַ
+			auto info{ RTTR::RealRTTRInfo<StressObject<4>>::instance() };
+			auto stringInfo{ RTTR::RTTRInfo::info("std::string") };
+			std::vector<std::string> names{};
+			std::vector<const RTTR::NormalMemberInfo*> members{};
+			for (int i = 0; i < 4096; ++i)
+			{
+				names.push_back("m_sealed" + std::to_string(i));
+				Assert::IsTrue(info->registerNormalMember({ names.back(), RTTR::Public, stringInfo, 0 }));
+				members.push_back(info->normalMember(names.back()));
+			}
+			auto object{ RTTR::RTTRInfo::info("AFakeObject") };
+			auto overloads{ object->normalMethod("normalFunc") };
+			auto constFunc{ object->constMethod("constFunc", RTTR::signature_traits<std::string(AFakeObject::*)() const>::value) };
+
+			RTTR::seal();
+			Assert::IsTrue(RTTR::sealed());
+			Assert::IsTrue(RTTR::frozen());
+
+			for (size_t i = 0; i < names.size(); ++i) Assert::IsTrue(info->normalMember(names[i]) == members[i]);
+			Assert::IsNull(info->normalMember("m_sealed"));
+			Assert::IsNull(info->normalMember("m_sealed4096"));
+			Assert::IsTrue(RTTR::RTTRInfo::info("AFakeObject") == object);
+			Assert::IsTrue(RTTR::RTTRInfo::info(info->name()) == info);
+			Assert::IsNull(RTTR::RTTRInfo::info("MissingObject"));
+			Assert::IsTrue(std::ranges::equal(object->normalMethod("normalFunc"), overloads));
+			Assert::IsTrue(object->normalMethod("missingFunc").empty());
+			Assert::IsTrue(object->constMethod("constFunc", RTTR::signature_traits<std::string(AFakeObject::*)() const>::value) == constFunc);
+			Assert::IsNull(object->constMethod("constFunc", RTTR::signature_traits<int(AFakeObject::*)() const>::value));
+
+			//ⶳעĳԱԲ鵽ıʹϣ
+			RTTR::thaw();
+			Assert::IsTrue(info->registerNormalMember({ "m_unsealed", RTTR::Public, stringInfo, 0 }));
+			Assert::IsNotNull(info->normalMember("m_unsealed"));
+			Assert::IsTrue(info->normalMember(names.front()) == members.front());
+			Assert::IsTrue(RTTR::sealed());
+		}
+
+		TEST_METHOD(RTTRInfo_internedNames_iterateInOrder)
+		{
+			auto info{ RTTR::RealRTTRInfo<StressObject<0>>::instance() };
+			auto other{ RTTR::RealRTTRInfo<StressObject<1>>::instance() };
+
+			//ʱַעַָ
+			for (auto name : { "m_first", "m_second", "m_third" })
+			{
+				info->registerNormalMember({ std::string{ name }, RTTR::Public, RTTR::RTTRInfo::info("std::string"), 0 });
+				other->registerNormalMember({ std::string{ name }, RTTR::Public, RTTR::RTTRInfo::info("std::string"), 0 });
+			}
+			Assert::IsTrue(info->normalMember("m_second")->name.data() == other->normalMember("m_second")->name.data());
+
+			std::vector<std::string_view> names{};
+			for (const auto& member : info->normalMembers())
+				if (member.name == "m_first" || member.name == "m_second" || member.name == "m_third") names.push_back(member.name);
+			Assert::IsTrue(names == std::vector<std::string_view>{ "m_first", "m_second", "m_third" });
+			Assert::AreEqual(info->normalMembers().size(), info->normalMemberNames().size());
+
+			size_t overloads{ 0 };
+			for (const auto& method : RTTR::RTTRInfo::info("AFakeObject")->normalMethods()) overloads += method.name == "normalFunc";
+			Assert::AreEqual(overloads, size_t{ 2 });
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_refAndSetMember_AreEqual)
+		{
+			auto object{ createAFakeObject() };
+			auto info{ RTTR::RTTRInfo::info("AFakeObject") };
+			auto member{ info->normalMember("m_string") };
+
+			Assert::IsTrue(&member->ref<std::string>(object) == &object->m_string);
+			Assert::IsTrue(&RTTR::crefNormalMember<std::string>(object, "AFakeObject", "m_string") == &object->m_string);
+
+			std::string value(64, 'x');
+			auto data{ value.data() };
+			member->set<std::string>(object, std::move(value));
+			Assert::IsTrue(object->m_string.data() == data);
+
+			RTTR::setNormalMember<std::string>(object, "AFakeObject", "m_string", std::string{ "set" });
+			Assert::AreEqual(object->m_string, std::string{ "set" });
+
+			auto handle{ RTTR::normalMemberHandle<std::string>("AFakeObject", "m_string") };
+			handle.set(object, "handle");
+			Assert::AreEqual(handle.cref(object), std::string{ "handle" });
+
+			auto old{ AFakeObject::s_string };
+			RTTR::setStaticMember<std::string>("AFakeObject", "s_string", std::string{ "static" });
+			Assert::AreEqual(RTTR::refStaticMember<std::string>("AFakeObject", "s_string"), std::string{ "static" });
+			RTTR::staticMemberHandle<std::string>("AFakeObject", "s_string").set(old);
+			Assert::AreEqual(AFakeObject::s_string, old);
+
+			Assert::IsFalse(static_cast<bool>(RTTR::normalMemberHandle<AFakeObject>("AFakeObject", "m_string")));
+			RTTR::destroy(object, "AFakeObject");
+		}
+
+		TEST_METHOD(BFakeObject_RTTR_gatherScatterMember_AreEqual)
+		{
+			std::vector<BFakeObject> objects(11);
+			for (size_t i = 0; i < objects.size(); ++i)
+			{
+				objects[i].m_x = static_cast<float>(i) * 0.5f;
+				objects[i].m_name = std::to_string(i);
+			}
+
+			std::vector<float> xs(objects.size());
+			RTTR::gatherNormalMember(objects.data(), objects.size(), "BFakeObject", "m_x", xs.data());
+			for (size_t i = 0; i < objects.size(); ++i) Assert::AreEqual(xs[i], objects[i].m_x);
+
+			std::vector<int> ids(objects.size());
+			for (size_t i = 0; i < ids.size(); ++i) ids[i] = static_cast<int>(i * 3);
+			RTTR::scatterNormalMember(objects.data(), objects.size(), "BFakeObject", "m_id", ids.data());
+			for (size_t i = 0; i < objects.size(); ++i) Assert::AreEqual(objects[i].m_id, ids[i]);
+			Assert::AreEqual(objects[10].m_x, 5.0f);
+
+			std::vector<std::string> names(objects.size());
+			RTTR::RTTRInfo::info("BFakeObject")->normalMember("m_name")->gather(objects.data(), objects.size(), sizeof(BFakeObject), names.data());
+			Assert::AreEqual(names[7], std::string{ "7" });
+
+			auto handle{ RTTR::normalMemberHandle<double>("BFakeObject", "m_weight") };
+			std::vector<double> weights(objects.size(), 2.0);
+			handle.scatter(objects.data(), 5, sizeof(BFakeObject), weights.data());
+			Assert::AreEqual(objects[4].m_weight, 2.0);
+			Assert::AreEqual(objects[5].m_weight, 1.0);
+		}
+
+		TEST_METHOD(CFakeObject_RTTR_serialize_roundTrip)
+		{
+			CFakeObject object{};
+			object.m_version = 7;
+			object.m_child.m_x = 1.5f;
+			object.m_child.m_name = "child";
+			object.m_ids = { 1, 2, 3 };
+			object.m_table = { { "a", 1 }, { "b", 2 } };
+			object.m_children.resize(2);
+			object.m_children[1].m_id = 42;
+			object.m_children[1].m_name = "second";
+
+			RTTR::BinaryWriter writer{};
+			RTTR::serialize(object, writer);
+
+			CFakeObject copy{};
+			RTTR::BinaryReader reader{ writer.data(), writer.size() };
+			Assert::IsTrue(RTTR::deserialize(copy, reader));
+			Assert::AreEqual(reader.remaining(), size_t{ 0 });
+			Assert::AreEqual(copy.m_version, 7);
+			Assert::AreEqual(copy.m_child.m_x, 1.5f);
+			Assert::AreEqual(copy.m_child.m_name, std::string{ "child" });
+			Assert::IsTrue(copy.m_ids == object.m_ids);
+			Assert::IsTrue(copy.m_table == object.m_table);
+			Assert::AreEqual(copy.m_children.size(), size_t{ 2 });
+			Assert::AreEqual(copy.m_children[1].m_id, 42);
+			Assert::AreEqual(copy.m_children[1].m_name, std::string{ "second" });
+
+			//Ͳģдֽͬ
+			RTTR::BinaryWriter erased{};
+			RTTR::RTTRInfo::info("CFakeObject")->serialize(&object, erased);
+			Assert::IsTrue(erased.size() == writer.size() && std::equal(erased.data(), erased.data() + erased.size(), writer.data()));
+
+			RTTR::BinaryReader truncated{ writer.data(), writer.size() - 1 };
+			Assert::IsFalse(RTTR::deserialize(copy, truncated));
+		}
+
+		TEST_METHOD(BFakeObject_RTTRInfo_plan_overflowSlots)
+		{
+			//೬λʱʹλ飬ÿֻһ
+			auto info{ RTTR::RTTRInfo::info("BFakeObject") };
+			Assert::IsTrue(plansDistinct(*info, std::make_integer_sequence<int, 20>{}));
+			Assert::AreEqual(info->plan<CountingPlan<19>>(&CountingPlan<19>::build).size, sizeof(BFakeObject));
+			Assert::AreEqual(info->plan<RTTR::BinaryPlan>(&RTTR::BinaryPlan::build).minSize, offsetof(BFakeObject, m_name));
+		}
+
+		TEST_METHOD(BFakeObject_RTTR_deserialize_countBoundedByMinSize)
+		{
+			//100Ԫأʣֻֽ33ȡǰܾС
+			RTTR::BinaryWriter writer{};
+			writer.write(uint64_t{ 100 });
+			for (int i = 0; i < 100; ++i) writer.write(uint64_t{ 0 });
+
+			std::vector<BFakeObject> objects{};
+			RTTR::BinaryReader reader{ writer.data(), writer.size() };
+			Assert::IsFalse(RTTR::deserialize(objects, reader));
+			Assert::IsTrue(objects.empty());
+
+			std::vector<double> values{};
+			RTTR::BinaryReader exact{ writer.data(), writer.size() };
+			Assert::IsTrue(RTTR::deserialize(values, exact));
+			Assert::AreEqual(values.size(), size_t{ 100 });
+		}
+
+		TEST_METHOD(CFakeObject_RTTR_diff_applyPatch)
+		{
+			CFakeObject base{};
+			base.m_ids = { 1, 2, 3 };
+			base.m_children.resize(2);
+
+			//ͬĶֻд
+			RTTR::BinaryWriter writer{};
+			Assert::AreEqual(RTTR::diff(base, base, writer), size_t{ 0 });
+			Assert::AreEqual(writer.size(), sizeof(uint16_t));
+
+			auto target{ base };
+			target.m_child.m_y = 2.5f;
+			target.m_child.m_name = "patched";
+			target.m_ids.push_back(4);
+
+			writer.clear();
+			Assert::AreEqual(RTTR::diff(base, target, writer), size_t{ 2 });
+
+			RTTR::BinaryWriter full{};
+			RTTR::serialize(target, full);
+			Assert::IsTrue(writer.size() < full.size());
+
+			auto copy{ base };
+			RTTR::BinaryReader reader{ writer.data(), writer.size() };
+			Assert::IsTrue(RTTR::applyPatch(copy, reader));
+			Assert::AreEqual(reader.remaining(), size_t{ 0 });
+			Assert::AreEqual(copy.m_child.m_y, 2.5f);
+			Assert::AreEqual(copy.m_child.m_name, std::string{ "patched" });
+			Assert::IsTrue(copy.m_ids == target.m_ids);
+			Assert::AreEqual(copy.m_children.size(), size_t{ 2 });
+
+			//m_x, m_y, m_z, m_idϲΪһαȽϣm_nameȽ
+			const auto& plan{ RTTR::RTTRInfo::info("BFakeObject")->plan<RTTR::DiffPlan>(&RTTR::DiffPlan::build) };
+			Assert::AreEqual(plan.fields.size(), size_t{ 6 });
+			Assert::IsTrue(plan.runs.front().end - plan.runs.front().begin >= 4);
+			Assert::IsTrue(plan.fields.back().kind == RTTR::DiffPlan::Value);
+
+			RTTR::BinaryReader truncated{ writer.data(), writer.size() - 1 };
+			copy = base;
+			Assert::IsFalse(RTTR::applyPatch(copy, truncated));
+
+			const uint16_t invalid[]{ 100, RTTR::DiffPlan::End };
+			RTTR::BinaryReader corrupt{ invalid, sizeof(invalid) };
+			Assert::IsFalse(RTTR::applyPatch(copy, corrupt));
+		}
+
+		TEST_METHOD(CFakeObject_RTTR_equalsHashClone)
+		{
+			CFakeObject object{};
+			object.m_ids = { 1, 2, 3 };
+			object.m_table = { { "a", 1 }, { "b", 2 } };
+			object.m_children.resize(2);
+
+			auto copy{ object };
+			Assert::IsTrue(RTTR::equals(object, copy));
+			Assert::AreEqual(RTTR::hash(object), RTTR::hash(copy));
+
+			copy.m_children[1].m_name = "changed";
+			Assert::IsFalse(RTTR::equals(object, copy));
+			copy.m_children[1].m_name = object.m_children[1].m_name;
+			copy.m_child.m_weight = 2.0;
+			Assert::IsFalse(RTTR::equals(object, copy));
+
+			//m_xm_weightϲΪһαȽϣm_nameȽ
+			const auto& plan{ RTTR::RTTRInfo::info("BFakeObject")->plan<RTTR::ValuePlan>(&RTTR::ValuePlan::build) };
+			Assert::AreEqual(plan.steps.size(), size_t{ 2 });
+			Assert::IsNull(plan.steps.front().info);
+			Assert::AreEqual(plan.steps.front().size, offsetof(BFakeObject, m_name));
+			Assert::IsFalse(plan.bytewise);
+
+			//ɰֽڱȽϵֵȽλģʽ
+			Assert::IsFalse(RTTR::equals(0.0, -0.0));
+			Assert::IsTrue(RTTR::equals(std::vector<int>{ 1, 2 }, std::vector<int>{ 1, 2 }));
+
+			auto info{ RTTR::RealRTTRInfo<CFakeObject>::instance() };
+			auto cloned{ RTTR::clone(object) };
+			Assert::IsNotNull(cloned);
+			Assert::IsTrue(info->equals(cloned, &object));
+			Assert::AreEqual(info->hash(cloned), RTTR::hash(object));
+			info->destroy(cloned);
+
+			CFakeObject assigned{};
+			Assert::IsTrue(RTTR::copyMembers(*info, &assigned, &copy));
+			Assert::IsTrue(RTTR::equals(assigned, copy));
+			Assert::AreEqual(assigned.m_child.m_weight, 2.0);
+
+			std::unordered_set<CFakeObject, RTTR::ValueHash<CFakeObject>, RTTR::ValueEqual<CFakeObject>> set{ object, copy, assigned };
+			Assert::AreEqual(set.size(), size_t{ 2 });
+			Assert::IsTrue(set.contains(copy));
+		}
+
+		TEST_METHOD(TrackedObject_RTTR_dirtyBits_writeDirty)
+		{
+			auto info{ RTTR::RealRTTRInfo<TrackedObject>::instance() };
+			TrackedObject object{};
+			Assert::IsFalse(RTTR::anyDirty(*info, &object));
+
+			//λΪע˳Աڶеλ޹
+			info->normalMember("m_x")->set<float>(&object, 1.5f);
+			object.setHp(50);
+			Assert::IsTrue(object.m_dirty.test(1) && object.m_dirty.test(2));
+			Assert::IsFalse(object.m_dirty.test(0));
+			Assert::IsTrue(info->normalMember("m_hp")->dirty(&object));
+
+			RTTR::setMember(&object, "TrackedObject", "m_name", RTTR::Variant{ "name" });
+			RTTR::normalMemberHandle<BFakeObject>("TrackedObject", "m_child").set(&object, BFakeObject{ .m_id = 7 });
+
+			std::vector<std::string_view> names{};
+			RTTR::forEachDirty(*info, &object, [&names](const RTTR::NormalMemberInfo& member) { names.push_back(member.name); });
+			Assert::IsTrue(names == std::vector<std::string_view>{ "m_name", "m_hp", "m_x", "m_child" });
+
+			//ֻдǵĳԱapplyPatchӦ
+			info->normalMember("m_name")->ref<std::string>(&object) = "untracked";
+			object.m_dirty.clear();
+			object.m_dirty.mark(1);
+			RTTR::markDirty<&TrackedObject::m_child>(object);
+
+			RTTR::BinaryWriter writer{};
+			Assert::AreEqual(RTTR::writeDirty(*info, &object, writer), size_t{ 2 });
+
+			TrackedObject copy{};
+			RTTR::BinaryReader reader{ writer.data(), writer.size() };
+			Assert::IsTrue(RTTR::applyPatch(copy, reader));
+			Assert::AreEqual(reader.remaining(), size_t{ 0 });
+			Assert::AreEqual(copy.m_hp, 50);
+			Assert::AreEqual(copy.m_child.m_id, 7);
+			Assert::AreEqual(copy.m_x, 0.0f);
+			Assert::IsTrue(copy.m_name.empty());
+			Assert::IsFalse(copy.m_dirty.any());
+
+			RTTR::clearDirty(*info, &object);
+			Assert::IsFalse(RTTR::anyDirty(*info, &object));
+
+			//עԱãδõûλ
+			Assert::IsFalse(info->registerDirtyBits(0, 64));
+			BFakeObject untracked{};
+			Assert::IsTrue(RTTR::RTTRInfo::info("BFakeObject")->dirtyBits(&untracked).empty());
+		}
+
+		TEST_METHOD(BFakeObject_RTTR_toJson_AreEqual)
+		{
+			BFakeObject object{};
+			object.m_x = 1.5f;
+			object.m_id = -3;
+			object.m_weight = 0.25;
+			object.m_name = "a\"b\\c\n";
+
+			RTTR::JsonWriter writer{};
+			RTTR::toJson(object, writer);
+			Assert::AreEqual(std::string{ writer.view() }, std::string{ R"({"m_x":1.5,"m_y":0,"m_z":0,"m_id":-3,"m_weight":0.25,"m_name":"a\"b\\c\n"})" });
+
+			//Ͳͬı
+			RTTR::JsonWriter erased{};
+			RTTR::RTTRInfo::info("BFakeObject")->writeJson(&object, erased);
+			Assert::IsTrue(erased.view() == writer.view());
+		}
+
+		TEST_METHOD(CFakeObject_RTTR_json_roundTrip)
+		{
+			CFakeObject object{};
+			object.m_version = 7;
+			object.m_child.m_y = 0.1f;
+			object.m_child.m_name = "child";
+			object.m_ids = { 1, 2, 3 };
+			object.m_table = { { "a", 1 }, { "b\t", 2 } };
+			object.m_children.resize(2);
+			object.m_children[1].m_weight = 1e300;
+			object.m_children[1].m_name = "second";
+
+			RTTR::JsonWriter writer{};
+			RTTR::toJson(object, writer);
+
+			CFakeObject copy{};
+			Assert::IsTrue(RTTR::fromJson(copy, writer.view()));
+			Assert::AreEqual(copy.m_version, 7);
+			Assert::AreEqual(copy.m_child.m_y, 0.1f);
+			Assert::AreEqual(copy.m_child.m_name, std::string{ "child" });
+			Assert::IsTrue(copy.m_ids == object.m_ids);
+			Assert::IsTrue(copy.m_table == object.m_table);
+			Assert::AreEqual(copy.m_children.size(), size_t{ 2 });
+			Assert::AreEqual(copy.m_children[1].m_weight, 1e300);
+			Assert::AreEqual(copy.m_children[1].m_name, std::string{ "second" });
+
+			//ûٴαõͬı
+			std::string first{ writer.view() };
+			writer.clear();
+			RTTR::toJson(copy, writer);
+			Assert::AreEqual(std::string{ writer.view() }, first);
+		}
+
+		TEST_METHOD(BFakeObject_RTTR_fromJson_AreEqual)
+		{
+			//˳⣬δעļԣȱٵļԭֵַеת屻
+			BFakeObject object{};
+			Assert::IsTrue(RTTR::fromJson(object, std::string_view{ R"( { "m_id" : 5, "unknown" : { "x" : [1, "}", null, true] }, "m_\u006eame" : "\u00e9\ud83d\ude00", "m_x" : -2e-1 } )" }));
+			Assert::AreEqual(object.m_id, 5);
+			Assert::AreEqual(object.m_x, -0.2f);
+			Assert::AreEqual(object.m_weight, 1.0);
+			Assert::AreEqual(object.m_name, std::string{ "\xC3\xA9\xF0\x9F\x98\x80" });
+
+			Assert::IsFalse(RTTR::fromJson(object, std::string_view{ R"({"m_id":})" }));
+			Assert::IsFalse(RTTR::fromJson(object, std::string_view{ R"({"m_id":1)" }));
+			Assert::IsFalse(RTTR::fromJson(object, std::string_view{ R"({"m_id":1} x)" }));
+			Assert::IsFalse(RTTR::fromJson(object, std::string_view{ R"({"m_id":"1"})" }));
+			Assert::IsFalse(RTTR::fromJson(object, std::string_view{ R"({"m_name":"\ud83d"})" }));
+		}
+
+		TEST_METHOD(BFakeObject_JsonPlan_findsEveryMember)
+		{
+			const auto& plan{ RTTR::RTTRInfo::info("BFakeObject")->plan<RTTR::JsonPlan>(&RTTR::JsonPlan::build) };
+
+			Assert::AreEqual(plan.fields.size(), size_t{ 6 });
+			Assert::AreEqual(plan.fields.front().prefix, std::string{ R"({"m_x":)" });
+			Assert::AreEqual(plan.fields.back().prefix, std::string{ R"(,"m_name":)" });
+			for (const auto& field : plan.fields) Assert::IsTrue(plan.find(field.name) == &field);
+			Assert::IsNull(plan.find("m_"));
+			Assert::IsNull(plan.find("m_names"));
+		}
+
+		TEST_METHOD(BFakeObject_BinaryPlan_coalescesTrivialMembers)
+		{
+			const auto& plan{ RTTR::RTTRInfo::info("BFakeObject")->plan<RTTR::BinaryPlan>(&RTTR::BinaryPlan::build) };
+
+			//m_x, m_y, m_z, m_idϲΪһΣm_weight֮ǰ䣬m_name
+			Assert::IsTrue(plan.steps.size() <= 3);
+			Assert::IsNull(plan.steps.front().info);
+			Assert::IsTrue(plan.steps.front().size >= sizeof(float) * 3 + sizeof(int));
+			Assert::IsTrue(plan.steps.back().info == RTTR::RTTRInfo::info("std::string"));
+		}
+
+		TEST_METHOD(BFakeObject_static_info_matchesRuntime)
+		{
+			static_assert(std::tuple_size_v<decltype(RTTR::static_info<BFakeObject>::members)> == 6);
+			static_assert(RTTR::staticMemberIndex<BFakeObject>("m_id") == 3);
+			static_assert(RTTR::staticMemberIndex<BFakeObject>("m_") == 6);
+			static_assert(RTTR::hasStaticInfo<BFakeObject> && !RTTR::hasStaticInfo<SnapshotV1>);
+
+			auto info{ RTTR::RTTRInfo::info("BFakeObject") };
+			Assert::AreEqual(info->normalMembers().size(), size_t{ 6 });
+
+			//ڱͬһɣơ˳ƫһ
+			BFakeObject object{};
+			size_t index{ 0 };
+			RTTR::for_each_member(object, [&](const auto& member, auto& value)
+				{
+					using value_t = std::remove_cvref_t<decltype(value)>;
+					auto runtime{ info->normalMember(member.name) };
+					Assert::IsNotNull(runtime);
+					Assert::IsTrue(info->normalMemberNames()[index++] == member.name);
+					Assert::IsTrue(RTTR::isType<value_t>(runtime->info));
+					Assert::IsTrue(&runtime->template ref<value_t>(&object) == &value);
+					if constexpr (std::is_arithmetic_v<value_t>) value += 1;
+				});
+			Assert::AreEqual(index, size_t{ 6 });
+			Assert::AreEqual(object.m_x, 1.0f);
+			Assert::AreEqual(object.m_id, 1);
+			Assert::AreEqual(object.m_weight, 2.0);
+
+			//ƫѹĶϼ㣬offsetofһ
+			Assert::AreEqual(RTTR::memberOffset<&SnapshotV1::m_y>(), static_cast<int>(offsetof(SnapshotV1, m_y)));
+		}
+
+		TEST_METHOD(AFakeObject_static_info_matchesRuntime)
+		{
+			auto info{ RTTR::RTTRInfo::info("AFakeObject") };
+			Assert::IsNotNull(info->staticMember("s_string"));
+			Assert::IsNotNull(info->normalMember("m_string"));
+
+			AFakeObject object{};
+			size_t count{ 0 };
+			RTTR::for_each_method<AFakeObject>([&](const auto& method)
+				{
+					using method_t = std::remove_cvref_t<decltype(method)>;
+					constexpr auto signature{ RTTR::signature_traits<typename method_t::pointer_t>::value };
+					if constexpr (method_t::isStatic) Assert::IsNotNull(info->staticMethod(method.name, signature));
+					else if constexpr (method_t::isConst) Assert::IsNotNull(info->constMethod(method.name, signature));
+					else Assert::IsNotNull(info->normalMethod(method.name, signature));
+					++count;
+				});
+			Assert::AreEqual(count, size_t{ 4 });
+
+			//̬Աڴıб
+			count = 0;
+			RTTR::for_each_member(object, [&](const auto& member, std::string& value)
+				{
+					Assert::IsTrue(member.name == "m_string");
+					Assert::AreEqual(value, std::string{ "AFakeObject::m_string" });
+					++count;
+				});
+			Assert::AreEqual(count, size_t{ 1 });
+			Assert::AreEqual(RTTR::invokeNormalMethod<std::string(AFakeObject::*)(std::string)>(&object, "AFakeObject", "normalFunc", std::string{ "x" }), std::string{ "AFakeObject::normalFunc(x)" });
+		}
+
+		TEST_METHOD(AFakeObject_Profile_countsCallsAndMisses)
+		{
+			using normalFunc_t = std::string(AFakeObject::*)();
+			auto info{ RTTR::RTTRInfo::info("AFakeObject") };
+			auto method{ info->normalMethod("normalFunc", RTTR::signature_traits<normalFunc_t>::value) };
+
+			RTTR::Profile::setSampling(1);
+			RTTR::Profile::reset();
+
+			//˳̵߳ļעʱϲ
+			AFakeObject object{};
+			std::vector<std::thread> threads{};
+			for (int t = 0; t < 4; ++t)
+			{
+				threads.emplace_back([&object]
+					{
+						for (int i = 0; i < 100; ++i) RTTR::invokeNormalMethod<normalFunc_t>(&object, "AFakeObject", "normalFunc");
+					});
+			}
+			for (auto& thread : threads) thread.join();
+			Assert::ExpectException<std::bad_function_call>([&object] { RTTR::invokeNormalMethod<std::string(AFakeObject::*)(int)>(&object, "AFakeObject", "normalFunc", 1); });
+
+			auto snapshot{ RTTR::Profile::snapshot() };
+			RTTR::Profile::setSampling(64);
+			if constexpr (!RTTR::Profile::Enabled)
+			{
+				Assert::IsTrue(snapshot.methods.empty());
+				Assert::AreEqual(snapshot.misses, uint64_t{ 0 });
+				return;
+			}
+
+			auto stats{ snapshot.find(method) };
+			Assert::IsNotNull(stats);
+			Assert::AreEqual(stats->calls, uint64_t{ 400 });
+			Assert::AreEqual(stats->sampled, uint64_t{ 400 });
+			Assert::IsTrue(stats->percentileNs(0.5) <= stats->percentileNs(0.99));
+			Assert::AreEqual(snapshot.misses, uint64_t{ 1 });
+			Assert::IsNotNull(snapshot.find(info));
+			Assert::AreEqual(snapshot.find(info)->misses, uint64_t{ 1 });
+			Assert::IsTrue(snapshot.toJson().find("\"signature\":\"AFakeObject::normalFunc()\",\"calls\":400") != std::string::npos);
+			Assert::IsTrue(snapshot.toText().find("AFakeObject::normalFunc()") != std::string::npos);
+
+			RTTR::Profile::reset();
+			Assert::IsNull(RTTR::Profile::snapshot().find(method));
+		}
+
+		TEST_METHOD(AFakeObject_RTTR_createDestroy_AreEqual)
+		{
+			auto info{ RTTR::RTTRInfo::info("AFakeObject") };
+			Assert::AreEqual(info->constructors().size(), size_t{ 2 });
+			Assert::IsNull(info->pool());
+
+			auto object{ static_cast<AFakeObject*>(RTTR::create("AFakeObject")) };
+			Assert::AreEqual(object->m_string, std::string{ "AFakeObject::m_string" });
+			RTTR::destroy(object, "AFakeObject");
+
+			object = static_cast<AFakeObject*>(info->create(std::string{ "created" }));
+			Assert::AreEqual(object->m_string, std::string{ "created" });
+			info->destroy(object);
+
+			//ͲĹ
+			std::string argument{ "erased" };
+			void* args[]{ &argument };
+			auto constructor{ info->constructor(RTTR::makeSignature<void, std::string>()) };
+			Assert::IsNotNull(constructor);
+			Assert::AreEqual(constructor->args.size(), size_t{ 1 });
+			object = static_cast<AFakeObject*>(info->create(*constructor, args));
+			Assert::AreEqual(object->m_string, std::string{ "erased" });
+			info->destroy(object);
+
+			Assert::IsNull(info->create(42));
+			Assert::IsNull(RTTR::create("MissingObject"));
+		}
+
+		TEST_METHOD(PooledObject_RTTR_poolReusesStorage)
+		{
+			auto info{ RTTR::RTTRInfo::info("PooledObject") };
+			auto pool{ info->pool() };
+			Assert::IsNotNull(pool);
+			Assert::IsFalse(info->registerPool(16));
+			Assert::AreEqual(pool->stride(), size_t{ 64 });
+
+			std::vector<PooledObject*> objects{};
+			for (int i = 0; i < 40; ++i) objects.push_back(static_cast<PooledObject*>(info->create(i, std::string{ "pooled" })));
+			Assert::AreEqual(pool->used(), size_t{ 40 });
+			Assert::AreEqual(PooledObject::s_live.load(), 40);
+			Assert::AreEqual(pool->reserved(), size_t{ 64 * 16 * 3 });
+			for (auto object : objects) Assert::IsTrue(reinterpret_cast<uintptr_t>(object) % 64 == 0);
+			Assert::AreEqual(objects[39]->m_value, 39);
+
+			//黹Ĵ洢һη临
+			auto released{ objects.back() };
+			info->destroy(released);
+			objects.pop_back();
+			Assert::AreEqual(PooledObject::s_live.load(), 39);
+			auto reused{ info->create(7, std::string{ "reused" }) };
+			Assert::IsTrue(reused == released);
+			objects.push_back(static_cast<PooledObject*>(reused));
+
+			for (auto object : objects) info->destroy(object);
+			Assert::AreEqual(pool->used(), size_t{ 0 });
+			Assert::AreEqual(PooledObject::s_live.load(), 0);
+
+			//ö֮ǰѴͨöѷͲ
+			RTTR::destroy(RTTR::create("AFakeObject"), "AFakeObject");
+			Assert::IsFalse(RTTR::RTTRInfo::info("AFakeObject")->registerPool(16));
+		}
+
+		TEST_METHOD(PooledObject_RTTR_poolAcrossThreads)
+		{
+			auto info{ RTTR::RTTRInfo::info("PooledObject") };
+			auto pool{ info->pool() };
+			auto usedBefore{ pool->used() };
+
+			//ÿ̴߳Ķ󽻸һ߳٣߳˳ʱ黹
+			constexpr size_t threadCount{ 4 };
+			constexpr size_t objectCount{ 1000 };
+			std::vector<std::vector<void*>> created(threadCount);
+			std::vector<std::thread> threads{};
+			for (size_t t = 0; t < threadCount; ++t)
+				threads.emplace_back([&created, info, t]
+					{
+						for (size_t i = 0; i < objectCount; ++i) created[t].push_back(info->create(static_cast<int>(i), std::string{ "threaded" }));
+					});
+			for (auto& thread : threads) thread.join();
+			threads.clear();
+			Assert::AreEqual(pool->used(), usedBefore + threadCount * objectCount);
+
+			for (size_t t = 0; t < threadCount; ++t)
+				threads.emplace_back([&created, info, t]
+					{
+						for (auto object : created[(t + 1) % threadCount]) info->destroy(object);
+					});
+			for (auto& thread : threads) thread.join();
+			Assert::AreEqual(pool->used(), usedBefore);
+		}
+
+		TEST_METHOD(ShapeLeaf_RTTR_isA_AreEqual)
+		{
+			auto leaf{ RTTR::RTTRInfo::info("ShapeLeaf") };
+			auto base{ RTTR::RTTRInfo::info("ShapeBase") };
+
+			Assert::IsTrue(leaf->isA(leaf));
+			Assert::IsTrue(leaf->isA(base));
+			Assert::IsTrue(leaf->isA(RTTR::RTTRInfo::info("ShapeTagged")));
+			Assert::IsFalse(base->isA(leaf));
+			Assert::IsFalse(leaf->isA(RTTR::RTTRInfo::info("BFakeObject")));
+			Assert::IsTrue(RTTR::isA("ShapeLeaf", "ShapeDerived"));
+			Assert::IsFalse(RTTR::isA("ShapeDerived", "ShapeLeaf"));
+
+			//ǰǰ
+			auto ancestors{ leaf->ancestors() };
+			Assert::AreEqual(ancestors.size(), size_t{ 4 });
+			Assert::IsTrue(ancestors[0].info == leaf && ancestors[0].offset == 0);
+			Assert::IsTrue(ancestors[1].info == RTTR::RTTRInfo::info("ShapeDerived"));
+		}
+
+		TEST_METHOD(ShapeLeaf_RTTR_upcastDowncast_AreEqual)
+		{
+			ShapeLeaf leaf{};
+			auto info{ RTTR::RTTRInfo::info("ShapeLeaf") };
+			auto tagged{ RTTR::RTTRInfo::info("ShapeTagged") };
+
+			Assert::IsTrue(info->upcast(&leaf, tagged) == static_cast<ShapeTagged*>(&leaf));
+			Assert::IsTrue(info->upcast(&leaf, RTTR::RTTRInfo::info("ShapeBase")) == static_cast<ShapeBase*>(&leaf));
+			Assert::IsTrue(tagged->downcast(static_cast<ShapeTagged*>(&leaf), info) == &leaf);
+			Assert::IsTrue(RTTR::upcast(&leaf, "ShapeLeaf", "ShapeTagged") == static_cast<ShapeTagged*>(&leaf));
+			Assert::IsTrue(RTTR::downcast(static_cast<ShapeTagged*>(&leaf), "ShapeTagged", "ShapeLeaf") == &leaf);
+			Assert::IsNull(info->upcast(&leaf, RTTR::RTTRInfo::info("BFakeObject")));
+			Assert::IsNull(tagged->downcast(&leaf, RTTR::RTTRInfo::info("ShapeBase")));
+
+			//̳μ̳еĵδֻ֪жϼ̳йϵ
+			ShapeVirtual virtualShape{};
+			Assert::IsTrue(RTTR::isA("ShapeVirtual", "ShapeBase"));
+			Assert::IsNull(RTTR::upcast(&virtualShape, "ShapeVirtual", "ShapeBase"));
+
+			ShapeDiamond diamond{};
+			Assert::IsTrue(RTTR::isA("ShapeDiamond", "ShapeBase"));
+			Assert::IsNull(RTTR::upcast(&diamond, "ShapeDiamond", "ShapeBase"));
+			Assert::IsTrue(RTTR::upcast(&diamond, "ShapeDiamond", "ShapeRight") == static_cast<ShapeRight*>(&diamond));
+		}
+
+		TEST_METHOD(ShapeLeaf_RTTR_inheritedMember_AreEqual)
+		{
+			ShapeLeaf leaf{};
+			auto info{ RTTR::RTTRInfo::info("ShapeLeaf") };
+
+			//m_idظm_id
+			auto id{ info->inheritedNormalMember("m_id") };
+			Assert::IsTrue(static_cast<bool>(id));
+			Assert::IsTrue(id.owner == RTTR::RTTRInfo::info("ShapeDerived"));
+			Assert::AreEqual(id.info->cref<int>(id.adjust(&leaf)), 3);
+
+			auto tag{ info->inheritedNormalMember("m_tag") };
+			Assert::IsTrue(tag.owner == RTTR::RTTRInfo::info("ShapeTagged"));
+			tag.info->set<double>(tag.adjust(&leaf), 5.0);
+			Assert::AreEqual(leaf.m_tag, 5.0);
+
+			Assert::IsTrue(info->inheritedStaticMember("s_count").info == RTTR::RTTRInfo::info("ShapeBase")->staticMember("s_count"));
+			Assert::IsFalse(static_cast<bool>(info->inheritedNormalMember("m_missing")));
+			Assert::IsNull(info->normalMember("m_tag"));
+
+			auto idMethod{ info->inheritedConstMethod("id") };
+			Assert::AreEqual(idMethod.info.size(), size_t{ 1 });
+			Assert::AreEqual(idMethod.info[0]->invoke<int(ShapeBase::*)() const>(static_cast<const ShapeBase*>(idMethod.adjust(static_cast<const void*>(&leaf)))), 1);
+
+			auto tagMethod{ info->inheritedNormalMethod("tag") };
+			tagMethod.info[0]->invoke<void(ShapeTagged::*)(double)>(static_cast<ShapeTagged*>(tagMethod.adjust(&leaf)), 7.0);
+			Assert::AreEqual(leaf.m_tag, 7.0);
+			Assert::IsTrue(info->inheritedStaticMethod("tag").info.empty());
+		}
+
+		TEST_METHOD(ShapeLeaf_RTTR_equalsInheritedMembers)
+		{
+			ShapeLeaf leaf{};
+			auto copy{ leaf };
+			Assert::IsTrue(RTTR::equals(leaf, copy));
+			Assert::AreEqual(RTTR::hash(leaf), RTTR::hash(copy));
+
+			//صĸԱĳԱͬȽ
+			static_cast<ShapeBase&>(copy).m_id = 9;
+			Assert::IsFalse(RTTR::equals(leaf, copy));
+			static_cast<ShapeBase&>(copy).m_id = leaf.ShapeBase::m_id;
+			copy.m_tag = 5.0;
+			Assert::IsFalse(RTTR::equals(leaf, copy));
+
+			//ShapeBase::m_idһΣShapeTagged::m_tagm_leafϲΪһ
+			auto tag{ static_cast<int>(reinterpret_cast<const char*>(&leaf.m_tag) - reinterpret_cast<const char*>(&leaf)) };
+			const auto& plan{ RTTR::RTTRInfo::info("ShapeLeaf")->plan<RTTR::ValuePlan>(&RTTR::ValuePlan::build) };
+			Assert::AreEqual(plan.steps.size(), size_t{ 2 });
+			Assert::AreEqual(plan.steps.front().size, sizeof(int));
+			Assert::AreEqual(plan.steps.back().offset, tag);
+			Assert::AreEqual(plan.steps.back().size, sizeof(ShapeLeaf) - tag);
+		}
+
+		TEST_METHOD(ShapeLeaf_RTTR_diffInheritedMembers)
+		{
+			ShapeLeaf base{};
+			auto target{ base };
+			static_cast<ShapeBase&>(target).m_id = 9;
+			target.m_tag = 5.0;
+
+			//ShapeBase::m_idm_tagShapeDerived::m_idm_leafΪֶ03
+			const auto& plan{ RTTR::RTTRInfo::info("ShapeLeaf")->plan<RTTR::DiffPlan>(&RTTR::DiffPlan::build) };
+			Assert::AreEqual(plan.fields.size(), size_t{ 4 });
+			Assert::AreEqual(plan.fields[0].offset, 0);
+			Assert::IsTrue(plan.fields[1].info == RTTR::RealRTTRInfo<double>::instance());
+			Assert::AreEqual(plan.fieldOf.size(), size_t{ 1 });
+			Assert::AreEqual(static_cast<size_t>(plan.fieldOf[0]), size_t{ 3 });
+
+			RTTR::BinaryWriter writer{};
+			Assert::AreEqual(RTTR::diff(base, target, writer), size_t{ 2 });
+
+			auto copy{ base };
+			RTTR::BinaryReader reader{ writer.data(), writer.size() };
+			Assert::IsTrue(RTTR::applyPatch(copy, reader));
+			Assert::AreEqual(copy.ShapeBase::m_id, 9);
+			Assert::AreEqual(copy.m_tag, 5.0);
+			Assert::IsTrue(RTTR::equals(copy, target));
+		}
+
+		TEST_METHOD(ShapeFixed_RTTR_memberOffsetWithoutConstruction)
+		{
+			struct Square : ShapeAbstract
+			{
+				int area() const override { return m_sides * m_sides; }
+			};
+
+			Square square{};
+			ShapeAbstract& shape{ square };
+			auto sides{ RTTR::RTTRInfo::info("ShapeAbstract")->normalMember("m_sides") };
+			Assert::IsNotNull(sides);
+			Assert::IsTrue(&sides->ref<int>(&shape) == &shape.m_sides);
+
+			ShapeFixed fixed{ 6 };
+			auto info{ RTTR::RTTRInfo::info("ShapeFixed") };
+			Assert::IsTrue(&info->normalMember("m_sides")->ref<int>(&fixed) == &fixed.m_sides);
+			Assert::AreEqual(info->normalMember("m_scale")->offset, static_cast<int>(offsetof(ShapeFixed, m_scale)));
+		}
+
+		TEST_METHOD(ShapeLate_RTTR_ancestorsRebuildAfterRegistration)
+		{
+			ShapeLate object{};
+			auto late{ RTTR::RealRTTRInfo<ShapeLate>::instance() };
+			auto tagged{ RTTR::RTTRInfo::info("ShapeTagged") };
+			Assert::IsFalse(late->isA(tagged));
+			Assert::IsFalse(static_cast<bool>(late->inheritedNormalMember("m_tag")));
+
+			//עԱʹչļ̳бڣ³Աֱӿɼ
+			auto ancestors{ late->ancestors().data() };
+			RTTR_REGISTER_NORMAL_MEMBER(ShapeLate, RTTR::Public, m_late);
+			Assert::IsTrue(late->ancestors().data() == ancestors);
+			Assert::IsTrue(late->inheritedNormalMember("m_late").owner == late);
+
+			//ڲѯ֮עᣬչļ̳б֮ؽ
+			RRTR_REGISTER_SUPERCLASS(ShapeLate, RTTR::Public, ShapeTagged);
+			Assert::IsTrue(late->ancestors().data() != ancestors);
+			Assert::IsTrue(late->isA(tagged));
+			Assert::IsTrue(late->inheritedNormalMember("m_tag").owner == tagged);
+			Assert::IsTrue(late->upcast(&object, tagged) == static_cast<ShapeTagged*>(&object));
+		}
+
+		TEST_METHOD(Snapshot_sameSchema_viewIsZeroCopy)
+		{
+			auto path{ std::filesystem::temp_directory_path() / "RTTRLibTests_snapshot_same.bin" };
+			std::vector<SnapshotV1> objects(100);
+			for (int i = 0; i < 100; ++i) objects[i] = { i, i * 0.5f, i * 2.0f };
+			Assert::IsTrue(RTTR::writeSnapshot(path, std::span<const SnapshotV1>{ objects }));
+
+			RTTR::Snapshot snapshot{};
+			Assert::IsTrue(snapshot.open(path));
+			Assert::AreEqual(snapshot.count(), size_t{ 100 });
+			Assert::IsTrue(snapshot.typeName() == "SnapshotV1");
+			Assert::IsTrue(snapshot.matches(*RTTR::RTTRInfo::info("SnapshotV1")));
+
+			auto view{ snapshot.view<SnapshotV1>() };
+			Assert::AreEqual(view.size(), size_t{ 100 });
+			Assert::AreEqual(view[42].m_id, 42);
+			Assert::AreEqual(view[42].m_y, 84.0f);
+			Assert::IsTrue(reinterpret_cast<uintptr_t>(view.data()) % alignof(SnapshotV1) == 0);
+
+			snapshot.close();
+			std::filesystem::remove(path);
+		}
+
+		TEST_METHOD(Snapshot_schemaEvolution_remapsByName)
+		{
+			auto path{ std::filesystem::temp_directory_path() / "RTTRLibTests_snapshot_evolved.bin" };
+			std::vector<SnapshotV1> objects(10);
+			for (int i = 0; i < 10; ++i) objects[i] = { i, i * 0.5f, i * 2.0f };
+			Assert::IsTrue(RTTR::writeSnapshot(path, std::span<const SnapshotV1>{ objects }));
+
+			RTTR::Snapshot snapshot{};
+			Assert::IsTrue(snapshot.open(path));
+			Assert::IsFalse(snapshot.matches(*RTTR::RTTRInfo::info("SnapshotV2")));
+			Assert::IsTrue(snapshot.view<SnapshotV2>().empty());
+
+			std::vector<SnapshotV2> evolved{};
+			snapshot.load(evolved);
+			Assert::AreEqual(evolved.size(), size_t{ 10 });
+			Assert::AreEqual(evolved[7].m_id, 7);
+			Assert::AreEqual(evolved[7].m_y, 14.0f);
+			Assert::AreEqual(evolved[7].m_z, -1.0);
+
+			std::vector<SnapshotV1> same{};
+			snapshot.load(same);
+			Assert::AreEqual(same[9].m_x, 4.5f);
+
+			snapshot.close();
+			std::filesystem::remove(path);
+		}
+
+		TEST_METHOD(Snapshot_corruptHeader_failsToOpen)
+		{
+			auto path{ std::filesystem::temp_directory_path() / "RTTRLibTests_snapshot_corrupt.bin" };
+			std::vector<SnapshotV1> objects(4);
+			Assert::IsTrue(RTTR::writeSnapshot(path, std::span<const SnapshotV1>{ objects }));
+			std::filesystem::resize_file(path, std::filesystem::file_size(path) - sizeof(SnapshotV1));
+
+			RTTR::Snapshot snapshot{};
+			Assert::IsFalse(snapshot.open(path));
+			Assert::IsFalse(snapshot.open(std::filesystem::temp_directory_path() / "RTTRLibTests_snapshot_missing.bin"));
+
+			//ֽļʶ֮뱾ͬʱʧ
+			Assert::IsTrue(RTTR::writeSnapshot(path, std::span<const SnapshotV1>{ objects }));
+			{
+				std::fstream file{ path, std::ios::binary | std::ios::in | std::ios::out };
+				uint32_t byteOrder{ 0 };
+				file.seekg(8);
+				file.read(reinterpret_cast<char*>(&byteOrder), sizeof(byteOrder));
+				byteOrder = (byteOrder >> 24) | ((byteOrder >> 8) & 0xFF00) | ((byteOrder << 8) & 0xFF0000) | (byteOrder << 24);
+				file.seekp(8);
+				file.write(reinterpret_cast<const char*>(&byteOrder), sizeof(byteOrder));
+			}
+			Assert::IsFalse(snapshot.open(path));
+
+			//ƽƵʱܾ
+			BFakeObject object{};
+			Assert::IsFalse(RTTR::writeSnapshot(path, *RTTR::RTTRInfo::info("BFakeObject"), &object, 1));
+			std::filesystem::remove(path);
+		}
+
+		TEST_METHOD(Snapshot_nestedLayoutChange_skipsField)
+		{
+			auto path{ std::filesystem::temp_directory_path() / "RTTRLibTests_snapshot_nested.bin" };
+			std::vector<SnapshotOuter> objects(3);
+			for (int i = 0; i < 3; ++i) objects[i] = { i, { i * 10, i * 100 } };
+			Assert::IsTrue(RTTR::writeSnapshot(path, std::span<const SnapshotOuter>{ objects }));
+
+			RTTR::Snapshot snapshot{};
+			Assert::IsTrue(snapshot.open(path));
+			Assert::IsTrue(snapshot.matches(*RTTR::RTTRInfo::info("SnapshotOuter")));
+
+			//Ƕ͵ֶα仯С䣬ָƲֶͬβֽٰڸ
+			auto nested{ RTTR::RealRTTRInfo<SnapshotNested>::instance() };
+			nested->normalMembers();
+			Assert::IsTrue(nested->registerNormalMember({ "m_c", RTTR::Public, RTTR::RealRTTRInfo<int>::instance(), RTTR::memberOffset<&SnapshotNested::m_b>() }));
+			Assert::IsFalse(snapshot.matches(*RTTR::RTTRInfo::info("SnapshotOuter")));
+
+			std::vector<SnapshotOuter> loaded{};
+			snapshot.load(loaded);
+			Assert::AreEqual(loaded[2].m_id, 2);
+			Assert::AreEqual(loaded[2].m_nested.m_a, 0);
+
+			snapshot.close();
+			std::filesystem::remove(path);
 		}
 	};
 }